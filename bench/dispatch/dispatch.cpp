@@ -0,0 +1,433 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Times the per-event and per-frame paths of a Binder on synthesized SDL_Event streams, without
+// initializing SDL. Allocations are counted by replacing the global operator new.
+//
+// usage: sib_bench [events per stream]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+#include <SDL.h>
+#include "sib.hpp"
+#include "alloc_count.hpp"
+
+typedef std::chrono::steady_clock Clock;
+
+// Events handled between ResetInputs() calls, about a frame's worth of busy input
+constexpr unsigned int frame_events = 64;
+
+static unsigned int seed = 1;
+
+static unsigned int Random()
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 8;
+}
+
+static double Nanoseconds(Clock::time_point start, Clock::time_point end)
+{
+	return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+static SDL_Event Key(SDL_Scancode scancode, bool down)
+{
+	SDL_Event e = {};
+	e.type = down ? SDL_KEYDOWN : SDL_KEYUP;
+	e.key.state = down ? SDL_PRESSED : SDL_RELEASED;
+	e.key.keysym.scancode = scancode;
+	return e;
+}
+
+static SDL_Event MouseButton(Uint8 button, bool down)
+{
+	SDL_Event e = {};
+	e.type = down ? SDL_MOUSEBUTTONDOWN : SDL_MOUSEBUTTONUP;
+	e.button.state = down ? SDL_PRESSED : SDL_RELEASED;
+	e.button.button = button;
+	return e;
+}
+
+static SDL_Event Wheel(int x, int y)
+{
+	SDL_Event e = {};
+	e.type = SDL_MOUSEWHEEL;
+	e.wheel.x = x;
+	e.wheel.y = y;
+	e.wheel.direction = SDL_MOUSEWHEEL_NORMAL;
+	return e;
+}
+
+static SDL_Event GamepadButton(SDL_JoystickID id, Uint8 button, bool down)
+{
+	SDL_Event e = {};
+	e.type = down ? SDL_CONTROLLERBUTTONDOWN : SDL_CONTROLLERBUTTONUP;
+	e.cbutton.which = id;
+	e.cbutton.state = down ? SDL_PRESSED : SDL_RELEASED;
+	e.cbutton.button = button;
+	return e;
+}
+
+static SDL_Event GamepadAxis(SDL_JoystickID id, Uint8 axis, Sint16 value)
+{
+	SDL_Event e = {};
+	e.type = SDL_CONTROLLERAXISMOTION;
+	e.caxis.which = id;
+	e.caxis.axis = axis;
+	e.caxis.value = value;
+	return e;
+}
+
+// Keys, buttons and wheel steps come as down/up pairs so the stream never leaves anything held
+static std::vector<SDL_Event> KeyboardStream(unsigned int count)
+{
+	static const SDL_Scancode keys[] = {SDL_SCANCODE_W, SDL_SCANCODE_A, SDL_SCANCODE_S, SDL_SCANCODE_D,
+		SDL_SCANCODE_SPACE, SDL_SCANCODE_LSHIFT, SDL_SCANCODE_E, SDL_SCANCODE_R};
+	std::vector<SDL_Event> events;
+
+	while (events.size() < count)
+	{
+		SDL_Scancode key = keys[Random() % 8];
+		events.push_back(Key(key, true));
+		events.push_back(Key(key, false));
+	}
+
+	return events;
+}
+
+static std::vector<SDL_Event> MouseStream(unsigned int count)
+{
+	std::vector<SDL_Event> events;
+
+	while (events.size() < count)
+	{
+		unsigned int r = Random();
+
+		if (r % 4 == 0)
+		{
+			events.push_back(Wheel(0, (r >> 4) % 2 ? 1 : -1));
+			continue;
+		}
+
+		Uint8 button = (Uint8)(1 + (r >> 4) % 5);
+		events.push_back(MouseButton(button, true));
+		events.push_back(MouseButton(button, false));
+	}
+
+	return events;
+}
+
+static std::vector<SDL_Event> GamepadStream(unsigned int count, unsigned int controllers)
+{
+	std::vector<SDL_Event> events;
+
+	while (events.size() < count)
+	{
+		unsigned int r = Random();
+		SDL_JoystickID id = (SDL_JoystickID)(r % controllers);
+
+		// Sticks send far more events than buttons
+		if ((r >> 8) % 4 == 0)
+		{
+			Uint8 button = (Uint8)((r >> 10) % SDL_CONTROLLER_BUTTON_MAX);
+			events.push_back(GamepadButton(id, button, true));
+			events.push_back(GamepadButton(id, button, false));
+		}
+		else
+		{
+			events.push_back(GamepadAxis(id, (Uint8)((r >> 10) % SDL_CONTROLLER_AXIS_MAX), (Sint16)(r >> 12)));
+		}
+	}
+
+	return events;
+}
+
+// A frame of play: mostly stick motion, some movement keys, the odd click and wheel step
+static std::vector<SDL_Event> MixedStream(unsigned int count)
+{
+	std::vector<SDL_Event> keyboard = KeyboardStream(count);
+	std::vector<SDL_Event> mouse = MouseStream(count);
+	std::vector<SDL_Event> gamepad = GamepadStream(count, 2);
+	std::vector<SDL_Event> events;
+	unsigned int k = 0, m = 0, g = 0;
+
+	while (events.size() < count)
+	{
+		unsigned int r = Random() % 10;
+
+		if (r < 6)
+		{
+			events.push_back(gamepad[g++]);
+		}
+		else if (r < 9)
+		{
+			events.push_back(keyboard[k++]);
+			events.push_back(keyboard[k++]);
+		}
+		else
+		{
+			events.push_back(mouse[m++]);
+		}
+	}
+
+	return events;
+}
+
+// Worst cases: every scancode held at once, sticks jittering across the thresholds, and more
+// controllers than there are slots
+static std::vector<SDL_Event> AllKeysStream(unsigned int count)
+{
+	std::vector<SDL_Event> events;
+
+	while (events.size() < count)
+	{
+		for (int i = 0; i < SDL_NUM_SCANCODES; ++i) events.push_back(Key((SDL_Scancode)i, true));
+		for (int i = 0; i < SDL_NUM_SCANCODES; ++i) events.push_back(Key((SDL_Scancode)i, false));
+	}
+
+	return events;
+}
+
+static std::vector<SDL_Event> JitterStream(unsigned int count)
+{
+	std::vector<SDL_Event> events;
+
+	while (events.size() < count)
+	{
+		Sint16 value = (Random() % 2) ? 32767 : -32768;
+		events.push_back(GamepadAxis(0, SDL_CONTROLLER_AXIS_LEFTX, value));
+		events.push_back(GamepadAxis(0, SDL_CONTROLLER_AXIS_LEFTX, 0));
+	}
+
+	return events;
+}
+
+static void Report(const char* name, double ns, double count, unsigned long allocs)
+{
+	std::printf("%-28s %9.2f ns/event %12.0f events/sec %8lu allocations\n", name, ns / count, count * 1e9 / ns, allocs);
+}
+
+static void RunStream(Sib::Binder& binder, const char* name, const std::vector<SDL_Event>& events)
+{
+	// One untimed pass sizes the transition buffer and adds the controllers
+	for (const SDL_Event& e : events) binder.HandleInput(e);
+	binder.ResetInputs();
+
+	double handle_ns = 0;
+	double reset_ns = 0;
+	unsigned long handle_allocations = 0;
+	unsigned long reset_allocations = 0;
+	unsigned int frames = 0;
+
+	for (std::size_t i = 0; i < events.size(); i += frame_events)
+	{
+		std::size_t end = std::min(events.size(), i + frame_events);
+
+		unsigned long start_allocations = allocations;
+		Clock::time_point start = Clock::now();
+		binder.HandleInputs(events.data() + i, (unsigned int)(end - i));
+		Clock::time_point middle = Clock::now();
+		handle_allocations += allocations - start_allocations;
+
+		start_allocations = allocations;
+		binder.ResetInputs();
+		Clock::time_point stop = Clock::now();
+		reset_allocations += allocations - start_allocations;
+
+		handle_ns += Nanoseconds(start, middle);
+		reset_ns += Nanoseconds(middle, stop);
+		++frames;
+	}
+
+	Report(name, handle_ns, (double)events.size(), handle_allocations);
+	std::printf("%-28s %9.2f ns/frame %31lu allocations\n", "  ResetInputs", reset_ns / frames, reset_allocations);
+}
+
+static void RunQueries(Sib::Binder& binder)
+{
+	constexpr unsigned int rounds = 100000;
+	unsigned int found = 0;
+
+	unsigned long start_allocations = allocations;
+	Clock::time_point start = Clock::now();
+
+	for (unsigned int i = 0; i < rounds; ++i)
+	{
+		for (unsigned int action = 0; action < SIB_MAX_ACTIONS; ++action)
+		{
+			found += binder.Pressed((Sib::Action_t)action);
+			found += binder.Released((Sib::Action_t)action);
+		}
+	}
+
+	Clock::time_point end = Clock::now();
+	double queries = (double)rounds * SIB_MAX_ACTIONS * 2;
+
+	std::printf("%-28s %9.2f ns/query %12.0f queries/sec %7lu allocations\n", "Pressed/Released",
+		Nanoseconds(start, end) / queries, queries * 1e9 / Nanoseconds(start, end), allocations - start_allocations);
+
+	// Keeps the loop from being optimized away
+	if (found == 0xffffffff) std::printf("\n");
+}
+
+static void RunReadFile()
+{
+	constexpr unsigned int lines = 1000;
+	constexpr int rounds = 200;
+
+	std::filesystem::path path = std::filesystem::temp_directory_path() / "sib_bench_binds.txt";
+
+	{
+		std::ofstream file(path, std::ios::binary);
+
+		for (unsigned int i = 0; i < lines; ++i)
+		{
+			file << "scancode " << Sib::ScancodeToString((SDL_Scancode)(4 + i % 40)) << " a" << i % SIB_MAX_ACTIONS << '\n';
+		}
+	}
+
+	Sib::Binder binder;
+
+	for (unsigned int i = 0; i < SIB_MAX_ACTIONS; ++i)
+	{
+		binder.ActionSetString((Sib::Action_t)i, "a" + std::to_string(i));
+	}
+
+	binder.ReadFile(path);
+
+	unsigned long start_allocations = allocations;
+	Clock::time_point start = Clock::now();
+
+	for (int i = 0; i < rounds; ++i)
+	{
+		binder.ReadFile(path);
+	}
+
+	Clock::time_point end = Clock::now();
+	double ns = Nanoseconds(start, end) / rounds;
+
+	std::printf("%-28s %9.2f ns/line %13.0f lines/sec %9lu allocations per load\n", "ReadFile",
+		ns / lines, lines * 1e9 / ns, (allocations - start_allocations) / rounds);
+
+	if (binder.Error() != Sib::NO_ERROR) std::printf("error: %s\n", binder.ErrorStr());
+	std::filesystem::remove(path);
+}
+
+static void RunPool(Sib::Binder& binder, unsigned int count)
+{
+	constexpr unsigned int players = 10000;
+	static const Uint16 inputs[] = {SDL_SCANCODE_W, SDL_SCANCODE_A, SDL_SCANCODE_S, SDL_SCANCODE_D, SDL_SCANCODE_SPACE,
+		SDL_SCANCODE_E, Sib::INPUT_MBUTTON, Sib::INPUT_CBUTTON + SDL_CONTROLLER_BUTTON_A};
+
+	Sib::BinderPool pool;
+	pool.AddProfile(binder);
+	pool.Players(players);
+
+	// Each tick every player sends a few presses and releases, in the order they arrive
+	std::vector<Sib::PoolEvent> events;
+
+	while (events.size() < count)
+	{
+		Uint32 player = Random() % players;
+		Uint16 input = inputs[Random() % 8];
+		events.push_back({player, input, true});
+		events.push_back({player, input, false});
+	}
+
+	constexpr std::size_t tick_events = players * 4;
+	double handle_ns = 0;
+	double reset_ns = 0;
+	unsigned long start_allocations = allocations;
+	unsigned int ticks = 0;
+
+	for (std::size_t i = 0; i < events.size(); i += tick_events)
+	{
+		std::size_t end = std::min(events.size(), i + tick_events);
+
+		Clock::time_point start = Clock::now();
+		pool.HandleEvents(events.data() + i, end - i);
+		Clock::time_point middle = Clock::now();
+		pool.ResetInputs();
+		Clock::time_point stop = Clock::now();
+
+		handle_ns += Nanoseconds(start, middle);
+		reset_ns += Nanoseconds(middle, stop);
+		++ticks;
+	}
+
+	Report("pool, 10000 players", handle_ns, (double)events.size(), allocations - start_allocations);
+	std::printf("%-28s %9.2f ns/tick %32s\n", "  ResetInputs", reset_ns / ticks, "");
+}
+
+int main(int argc, char** argv)
+{
+	unsigned int count = argc > 1 ? (unsigned int)std::atoi(argv[1]) : 1000000;
+
+	// Bind a realistic set of inputs, a few of them to several actions
+	Sib::Binder binder;
+	binder.MapScancode(SDL_SCANCODE_W, 0);
+	binder.MapScancode(SDL_SCANCODE_A, 1);
+	binder.MapScancode(SDL_SCANCODE_S, 2);
+	binder.MapScancode(SDL_SCANCODE_D, 3);
+	binder.MapScancode(SDL_SCANCODE_SPACE, 4);
+	binder.MapScancode(SDL_SCANCODE_LSHIFT, 5);
+	binder.MapScancode(SDL_SCANCODE_E, 6);
+	binder.MapScancode(SDL_SCANCODE_E, 7);
+	binder.MapMouseButton(SDL_BUTTON_LEFT, 8);
+	binder.MapMouseButton(SDL_BUTTON_RIGHT, 9);
+	binder.MapMouseWheelUp(10);
+	binder.MapMouseWheelDown(11);
+	binder.MapGamepadButton(SDL_CONTROLLER_BUTTON_A, 4);
+	binder.MapGamepadButton(SDL_CONTROLLER_BUTTON_B, 12);
+	binder.MapGamepadButton(SDL_CONTROLLER_BUTTON_START, 13);
+	binder.MapGamepadAxis(Sib::Axis::Left_Y_Neg, 0);
+	binder.MapGamepadAxis(Sib::Axis::Left_X_Neg, 1);
+	binder.MapGamepadAxis(Sib::Axis::Left_Y_Pos, 2);
+	binder.MapGamepadAxis(Sib::Axis::Left_X_Pos, 3);
+	binder.MapGamepadAxis(Sib::Axis::Right_Trigger, 8);
+	binder.MapGamepadAxis(Sib::Axis::Left_Trigger, 9);
+
+	RunStream(binder, "keyboard", KeyboardStream(count));
+	RunStream(binder, "mouse buttons + wheel", MouseStream(count));
+	RunStream(binder, "controller buttons + axes", GamepadStream(count, 4));
+	RunStream(binder, "mixed", MixedStream(count));
+	RunQueries(binder);
+
+	// Every input bound to every action
+	Sib::Binder crowded;
+
+	for (unsigned int action = 0; action < SIB_MAX_ACTIONS; ++action)
+	{
+		for (int i = 0; i < SDL_NUM_SCANCODES; ++i) crowded.MapScancode((SDL_Scancode)i, (Sib::Action_t)action);
+		crowded.MapGamepadAxis(Sib::Axis::Left_X_Pos, (Sib::Action_t)action);
+		crowded.MapGamepadAxis(Sib::Axis::Left_X_Neg, (Sib::Action_t)action);
+	}
+
+	RunStream(crowded, "all keys, all actions", AllKeysStream(count));
+	RunStream(crowded, "axis jitter, all actions", JitterStream(count));
+	RunStream(binder, "too many controllers", GamepadStream(count, SIB_MAX_CONTROLLERS * 4));
+
+	RunPool(binder, count);
+	RunReadFile();
+	return 0;
+}
@@ -0,0 +1,124 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Startup and lookup cost of the config name tables. The tables are sorted at compile time, so the
+// startup cost is compared against building the same lists into std::unordered_map like older
+// versions did during static initialization.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <SDL.h>
+#include "sib.hpp"
+#include "sib_maps.hpp"
+
+typedef std::chrono::steady_clock Clock;
+
+static double Nanoseconds(Clock::time_point start, Clock::time_point end)
+{
+	return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+template<typename T, std::size_t N>
+static std::unordered_map<std::string, T> BuildMap(const Sib::NameEntry<T> (&list)[N])
+{
+	std::unordered_map<std::string, T> map;
+
+	for (const Sib::NameEntry<T>& entry : list)
+	{
+		map.emplace(std::string(entry.name), entry.value);
+	}
+
+	return map;
+}
+
+int main()
+{
+	constexpr int rounds = 1000;
+	unsigned int found = 0;
+
+	// First lookup after startup, the tables may not even be paged in yet
+	Clock::time_point start = Clock::now();
+	SDL_Scancode scancode;
+	found += Sib::ScancodeFromString("SPACE", scancode);
+	Clock::time_point end = Clock::now();
+	std::printf("first lookup:              %10.0f ns\n", Nanoseconds(start, end));
+
+	// What the unordered_map tables cost to build before main()
+	start = Clock::now();
+
+	for (int i = 0; i < rounds; ++i)
+	{
+		found += BuildMap(Sib::scancode_list).size();
+		found += BuildMap(Sib::keycode_list).size();
+		found += BuildMap(Sib::cbutton_list).size();
+		found += BuildMap(Sib::caxis_list).size();
+		found += BuildMap(Sib::mbutton_list).size();
+	}
+
+	end = Clock::now();
+	std::printf("unordered_map build:       %10.0f ns (not done at startup any more)\n", Nanoseconds(start, end) / rounds);
+
+	start = Clock::now();
+
+	for (int i = 0; i < rounds; ++i)
+	{
+		for (const Sib::NameEntry<SDL_Scancode>& entry : Sib::scancode_list)
+		{
+			found += Sib::ScancodeFromString(entry.name, scancode);
+		}
+	}
+
+	end = Clock::now();
+	std::printf("scancode name -> value:    %10.1f ns\n", Nanoseconds(start, end) / (rounds * std::size(Sib::scancode_list)));
+
+	start = Clock::now();
+
+	for (int i = 0; i < rounds; ++i)
+	{
+		for (const Sib::NameEntry<SDL_Scancode>& entry : Sib::scancode_list)
+		{
+			found += Sib::ScancodeToString(entry.value).size();
+		}
+	}
+
+	end = Clock::now();
+	std::printf("scancode value -> name:    %10.1f ns\n", Nanoseconds(start, end) / (rounds * std::size(Sib::scancode_list)));
+
+	SDL_Keycode keycode;
+	start = Clock::now();
+
+	for (int i = 0; i < rounds; ++i)
+	{
+		for (const Sib::NameEntry<SDL_Keycode>& entry : Sib::keycode_list)
+		{
+			found += Sib::KeycodeFromString(entry.name, keycode);
+		}
+	}
+
+	end = Clock::now();
+	std::printf("keycode name -> value:     %10.1f ns\n", Nanoseconds(start, end) / (rounds * std::size(Sib::keycode_list)));
+
+	// Keeps the loops from being optimized away
+	std::printf("(%u)\n", found);
+
+	return 0;
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Generates a 100k line bind file and times ReadFile() on it. Allocations are counted by replacing
+// the global operator new.
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <SDL.h>
+#include "sib.hpp"
+#include "alloc_count.hpp"
+
+typedef std::chrono::steady_clock Clock;
+
+static const char* action_names[] = {"jump", "crouch", "fire", "reload", "use", "menu", "left", "right"};
+static const char* scancodes[] = {"A", "B", "C", "D", "SPACE", "LCTRL", "LSHIFT", "F1", "KP_5", "RETURN"};
+static const char* cbuttons[] = {"A", "B", "X", "Y", "START", "DPAD_UP", "LEFTSHOULDER"};
+static const char* axes[] = {"LEFTXPOS", "LEFTXNEG", "TRIGGERLEFT", "TRIGGERRIGHT"};
+
+static void WriteFile(const std::filesystem::path& path, unsigned int lines)
+{
+	std::ofstream file(path, std::ios::binary);
+	unsigned int seed = 1;
+
+	for (unsigned int i = 0; i < lines; ++i)
+	{
+		seed = seed * 1103515245 + 12345;
+		unsigned int r = seed >> 8;
+		const char* action = action_names[r % 8];
+
+		switch ((r >> 4) % 8)
+		{
+		case 0:
+		case 1:
+		case 2:
+			file << "scancode " << scancodes[(r >> 8) % 10] << ' ' << action << '\n';
+			break;
+		case 3:
+			file << "keycode " << (char)('a' + (r >> 8) % 26) << ' ' << action << '\n';
+			break;
+		case 4:
+			file << "cbutton " << cbuttons[(r >> 8) % 7] << ' ' << action << '\n';
+			break;
+		case 5:
+			file << "caxis " << axes[(r >> 8) % 4] << ' ' << action << '\n';
+			break;
+		case 6:
+			file << "mbutton LEFT " << action << '\n';
+			break;
+		case 7:
+			file << "unmap_scancode " << scancodes[(r >> 8) % 10] << '\n';
+			break;
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	constexpr unsigned int lines = 100000;
+	constexpr int rounds = 20;
+
+	std::filesystem::path path = std::filesystem::temp_directory_path() / "sib_readfile_bench.txt";
+	if (argc > 1) path = argv[1];
+	WriteFile(path, lines);
+
+	Sib::Binder binder;
+
+	for (unsigned int i = 0; i < 8; ++i)
+	{
+		binder.ActionSetString((Sib::Action_t)i, action_names[i]);
+	}
+
+	// The first load sizes the file buffer and binding tables
+	unsigned long start_allocations = allocations;
+	Clock::time_point start = Clock::now();
+	binder.ReadFile(path);
+	Clock::time_point end = Clock::now();
+
+	std::printf("first load:   %8.2f ms, %lu allocations\n",
+		std::chrono::duration<double, std::milli>(end - start).count(), allocations - start_allocations);
+
+	start_allocations = allocations;
+	start = Clock::now();
+
+	for (int i = 0; i < rounds; ++i)
+	{
+		binder.ReadFile(path);
+	}
+
+	end = Clock::now();
+	double ms = std::chrono::duration<double, std::milli>(end - start).count() / rounds;
+
+	std::printf("later loads:  %8.2f ms, %.1f ns/line, %lu allocations\n",
+		ms, ms * 1e6 / lines, (allocations - start_allocations) / rounds);
+
+	if (binder.Error() != Sib::NO_ERROR) std::printf("error: %s\n", binder.ErrorStr());
+
+	std::filesystem::remove(path);
+	return 0;
+}
@@ -21,6 +21,7 @@
 #include <cstdio>
 #include <SDL.h>
 #include "sib.hpp"
+#include "sib_watch.hpp"
 
 // Define actions
 constexpr Sib::Action_t q = 0;
@@ -64,6 +65,9 @@ int main(int argc, char** argv)
 	// Error() will return the last error (if any) and ErrorStr() will provide a pointer to description of the problem.
 	if (input.Error() == Sib::OPEN_FILE) return -1;
 
+	// Reload the binds whenever the file is saved
+	Sib::Watcher watcher(input, path);
+
 	// SDL setup
 	SDL_Init(SDL_INIT_EVERYTHING);
 	SDL_Window* window = SDL_CreateWindow("sib basic", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 200, 200, 0);
@@ -0,0 +1,118 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <SDL.h>
+#include "sib.hpp"
+
+// Define actions
+constexpr Sib::Action_t q = 0;
+constexpr Sib::Action_t up = 1;
+constexpr Sib::Action_t left_mb = 2;
+constexpr Sib::Action_t button_a = 3;
+
+std::atomic<bool> quit = false;
+Sib::Binder input;
+Sib::TransitionRing ring;
+
+// Runs at a fixed 60 ticks per second, whatever rate the input thread polls at
+void Simulation()
+{
+	Sib::ActionState state;
+	auto next_tick = std::chrono::steady_clock::now();
+
+	while (!quit)
+	{
+		next_tick += std::chrono::microseconds(16667);
+		std::this_thread::sleep_until(next_tick);
+
+		// Take everything the input thread has sent since the last tick
+		state.Consume(ring);
+
+		if (state.Pressed(q))
+		{
+			quit = true;
+			std::printf("q key pressed\n");
+		}
+
+		if (state.Pressed(up))
+		{
+			std::printf("up key pressed\n");
+		}
+
+		if (state.Held(left_mb))
+		{
+			std::printf("left mouse button held\n");
+		}
+
+		if (state.Pressed(button_a, 0))
+		{
+			std::printf("player 0 pressed a\n");
+		}
+
+		state.ResetInputs();
+	}
+}
+
+int main()
+{
+	// SDL setup
+	SDL_Init(SDL_INIT_EVERYTHING);
+	SDL_Window* window = SDL_CreateWindow("sib threaded", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 200, 200, 0);
+
+	// Map inputs to actions
+	input.MapScancode(SDL_SCANCODE_Q, q);
+	input.MapScancode(SDL_SCANCODE_UP, up);
+	input.MapMouseButton(SDL_BUTTON_LEFT, left_mb);
+	input.MapGamepadButton(SDL_CONTROLLER_BUTTON_A, button_a);
+
+	// Send action transitions to the ring instead of reading them here
+	input.TransitionOutput(&ring);
+
+	std::thread simulation(Simulation);
+
+	// SDL events have to be handled on the thread that created the window, so this is the input
+	// thread. It wakes up as soon as an event arrives.
+	SDL_Event e;
+
+	while (!quit)
+	{
+		if (SDL_WaitEventTimeout(&e, 10))
+		{
+			input.HandleInput(e);
+			if (e.type == SDL_QUIT) quit = true;
+
+			if (e.type == SDL_CONTROLLERDEVICEADDED)
+			{
+				SDL_GameControllerOpen(e.cdevice.which);
+			}
+		}
+
+		input.ResetInputs();
+	}
+
+	simulation.join();
+	SDL_DestroyWindow(window);
+	SDL_Quit();
+	return 0;
+}
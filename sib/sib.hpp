@@ -24,16 +24,16 @@
 //
 // - Building -
 //
-//		Place sib.hpp and sib_maps.hpp somewhere that your project can find them or add their
-//		location to the include path.
+//		Place sib.hpp, sib_binder.hpp, sib_readfile.hpp, sib_ring.hpp, sib_record.hpp,
+//		sib_names.hpp, sib_pool.hpp, sib_snapshot.hpp, sib_watch.hpp and sib_maps.hpp somewhere that
+//		your project can find them or add their location to the include path.
 //
-//		(The files #include sib.hpp and sib_maps.hpp without any preceding path)
+//		(The files #include each other without any preceding path)
 //
 //		example g++ command (assuming source files in ./sib and header files in ./include/sib):
 //
-//			g++ -o my_program main.cpp sib/sib.cpp sib/sib_readfile.cpp \
-//			-I./include/sib -I{SDL header directory} \
-//			-lSDL2 -lSDL2main 
+//			g++ -o my_program main.cpp sib/sib.cpp sib/sib_readfile.cpp -I./include/sib
+//				-I{SDL header directory} -lSDL2 -lSDL2main
 //     
 // - Basic use -
 //
@@ -88,31 +88,483 @@
 //			The ReadFile() function can be used to configure input binds at runtime. Syntax is
 //			described in config_syntax.txt
 //
+//			The whole file is read into a buffer owned by the Binder with a single read and parsed in
+//			place, so loading a file only allocates when it is bigger than any file loaded before.
+//			ReadString(std::string_view text) parses config text that is already in memory.
+//
+//		Action Strings
+//
+//			ActionSetString(Sib::Action_t action, std::string_view action_str) names an action for config
+//			files. Names are copied into one buffer owned by the Binder and looked up by hash, so reading
+//			a line doesn't allocate or build a std::string. ActionFromString() looks a name up.
+//
+//			AutoActions(true) gives a name that isn't registered the lowest action that has no name yet
+//			instead of reporting BAD_ACTION_STR. Use ActionFromString() afterwards to find the actions a
+//			config created:
+//
+//				binder.AutoActions(true);
+//				binder.ReadFile("binds.txt");
+//				binder.ActionFromString("jump", jump);
+//
+//			The hot reload watcher only uses the names that exist when it is created.
+//
+//		Keycodes
+//
+//			MapKeycode(SDL_Keycode keycode, Sib::Action_t action) binds the key that types a character
+//			in the current keyboard layout, the keycode command does the same from a config file:
+//
+//				binder.MapKeycode(SDLK_z, Action_Forward);
+//
+//			Keycode binds are resolved to scancodes when they are mapped, so a key press is looked up the
+//			same way as a scancode bind. When HandleInput() gets SDL_KEYMAPCHANGED the keycodes are
+//			resolved again and only the binds whose key moved are changed. A keycode that no key types
+//			in the current layout is kept, reported as NO_SCANCODE and bound once a layout has it.
+//			A key bound both by keycode and by scancode keeps one bind when the other is removed:
+//			UnmapKeycode() only removes the binds of that keycode and UnmapScancode() only the scancode
+//			binds.
+//
+//		Chords and Sequences
+//
+//			A chord holds an action while a set of inputs is held down together. A sequence presses and
+//			releases an action once when a series of steps is pressed in order within a time limit in
+//			milliseconds. Each step is a set of inputs, so a step can be a diagonal or a button with a
+//			direction:
+//
+//				binder.MapScancodeChord({SDL_SCANCODE_LCTRL, SDL_SCANCODE_S}, Action_Save);
+//				binder.MapGamepadButtonSequence({{SDL_CONTROLLER_BUTTON_DPAD_DOWN},
+//				    {SDL_CONTROLLER_BUTTON_DPAD_DOWN, SDL_CONTROLLER_BUTTON_DPAD_RIGHT},
+//				    {SDL_CONTROLLER_BUTTON_DPAD_RIGHT, SDL_CONTROLLER_BUTTON_X}}, 300, Action_Special);
+//
+//			The config file has chord and sequence commands for the same thing. UnmapCombos(Sib::Action_t
+//			action) removes every chord and sequence of an action.
+//
+//			Each input has a list of the chords and sequences that use it, so a press only checks the
+//			few that could advance. Controller chords and sequences are tracked for each controller.
+//			The inputs keep their own binds. There can be SIB_MAX_COMBOS (default 32) chords and
+//			sequences with up to SIB_COMBO_STEPS (default 8) steps of 4 inputs each.
+//
+//		Contexts
+//
+//			A context is a separate set of binds that can be pushed on top of the default ones, for
+//			menus, vehicles and so on. AddContext(name, priority, consume) creates one and returns its
+//			id, FindContext(name) looks it up later. EditContext(id) picks which context the Map and
+//			Unmap functions, ReadFile(), ReadString() and the compiled profile functions work on, the
+//			default context is 0:
+//
+//				int menu = binder.AddContext("menu", 10);
+//				binder.EditContext(menu);
+//				binder.ReadFile("menu_binds.txt");
+//				binder.EditContext(0);
+//
+//				binder.PushContext(menu);
+//				// ...
+//				binder.PopContext();
+//
+//			Active contexts are checked from the highest priority down and the default context is
+//			always last. Contexts consume input by default, hiding the binds of lower contexts for every
+//			input they bind. A context added with consume = false adds its binds to the ones below.
+//
+//			The merged table for each set of active contexts is built the first time that set is used
+//			and kept, so later switches and every event only cost a lookup. Changing the binds of any
+//			context rebuilds the tables on the next event. Held inputs whose actions change on a switch
+//			are released and ignored until they are pressed again. A Watcher always reloads the
+//			default context.
+//
+//		Rebinding
+//
+//			Inputs are numbered from Sib::INPUT_SCANCODE + scancode, Sib::INPUT_CBUTTON + button,
+//			Sib::INPUT_CAXIS + axis, Sib::INPUT_MBUTTON + button - 1 and Sib::INPUT_WHEEL (left, right,
+//			down, up). InputActions(unsigned int input, unsigned int& count) returns the actions already
+//			on an input and ActionInputs(Sib::Action_t action, unsigned int& count) returns the inputs
+//			that trigger an action, without searching every input:
+//
+//				unsigned int count;
+//				const Uint16* inputs = binder.ActionInputs(Action_Jump, count);
+//
+//				for (unsigned int i = 0; i < count; ++i)
+//				{
+//				    std::string_view name;
+//				    Sib::Command command = Sib::InputToString(inputs[i], name);
+//				    // Show CommandToString(command) and name...
+//				}
+//
+//			Both look at the bindings being edited and leave out chords and sequences. The lists are
+//			kept up to date by every Map and Unmap call.
+//
+//			Rebinding an input while it is held presses or releases the added or removed action right
+//			away, so the action isn't left held or released twice when the input goes up.
+//
+//			SaveFile(std::filesystem::path path) writes the bindings being edited as a config file,
+//			including chords and sequences.
+//			Binds of actions that have no action string are left out and reported as BAD_ACTION_STR.
+//
+//		Compiled Profiles
+//
+//			SaveCompiled(std::filesystem::path path) writes the current bindings to a binary file and
+//			LoadCompiled(std::filesystem::path path) replaces the bindings with the ones in the file.
+//			Loading is a single read and a copy, there is no parsing or action string lookup. The file
+//			is rejected with BAD_COMPILED if it was saved by a different version of Sib, a Binder with a
+//			different number of actions or action type, or a machine with a different byte order.
+//
+//			The sib_compile tool converts text profiles into compiled ones:
+//
+//				sib_compile actions.txt binds.txt binds.sibc
+//
+//			actions.txt lists the action strings and their numbers, one "string number" pair per line.
+//			Keycodes are resolved with the default US layout, compiled profiles only keep the scancodes
+//			they resolved to.
+//
+//		Hot Reload
+//
+//			A Sib::Watcher reloads a bind file whenever it changes on disk. It is in sib_watch.hpp, which
+//			isn't included by sib.hpp since it needs threads:
+//
+//				#include "sib_watch.hpp"
+//
+//				binder.ReadFile("binds.txt");
+//				Sib::Watcher watcher(binder, "binds.txt");
+//
+//			The file is parsed on the watcher's own thread into a new set of tables, starting from no
+//			binds at all. The next ResetInputs() swaps the new tables in, so a frame never sees a half
+//			loaded file. Inputs held during the swap are released through the old tables, so their
+//			actions are reported released in the next frame. Keycodes are looked up during the swap,
+//			since SDL can only do that on the main thread. A reload with errors keeps the old tables,
+//			its errors are reported from ResetInputs() on the main thread.
+//
+//			On Linux the watcher uses inotify, elsewhere it checks the modification time of the file a
+//			few times per second. Action strings are copied when the watcher is created, so call
+//			ActionSetString() first.
+//
+//		Recording and Replay
+//
+//			RecordEvents(std::vector<Sib::RecordedEvent>* record) appends every event that HandleInput()
+//			acts on to record, along with a marker for each ResetInputs(). A recorded event is 16 bytes,
+//			events the Binder ignores (mouse motion, window events...) aren't kept. Pass nullptr to stop.
+//
+//				std::vector<Sib::RecordedEvent> record;
+//				binder.RecordEvents(&record);
+//				// ... play ...
+//				binder.SaveRecord("session.sibr", record);
+//
+//			ReplayEvents(const Sib::RecordedEvent* events, std::size_t count) feeds a record back through
+//			the same handlers, calling ResetInputs() at each marker. Replay doesn't call into SDL, so it
+//			works without SDL_Init() or a window:
+//
+//				binder.LoadRecord("session.sibr", record);
+//				binder.ReplayEvents(record.data(), record.size());
+//
+//			Replaying a record through a Binder with the same binds gives the same transitions as the
+//			original session. To keep the resulting transitions instead, copy Transitions() before
+//			each ResetInputs(). Keyboard layout changes are recorded too, replaying one resolves the
+//			keycode binds again through SDL.
+//
+//			The sib_replay tool replays a record through a compiled profile as fast as it can and
+//			reports the throughput:
+//
+//				sib_replay binds.sibc session.sibr [passes]
+//
+//		Input Thread
+//
+//			A Binder can run on its own input thread and pass action transitions to the simulation
+//			through a Sib::TransitionRing, a lock free single producer/single consumer ring. On the
+//			simulation thread a Sib::ActionState turns the transitions back into pressed, released and
+//			held state:
+//
+//				Sib::TransitionRing ring;
+//				binder.TransitionOutput(&ring);
+//
+//				// Input thread
+//				binder.PollEvents();
+//				binder.ResetInputs();
+//
+//				// Simulation thread, once per tick
+//				state.Consume(ring);
+//				if (state.Pressed(Action_Jump)) { /* ... */ }
+//				state.ResetInputs();
+//
+//			A transition is sent whenever an action starts or stops being held, with the timestamp of
+//			the SDL event that caused it. Transitions with player -1 are for the combined state of every
+//			device and the rest are for a single controller. The ring holds SIB_RING_SIZE (default
+//			1024) transitions by default, if the consumer falls that far behind new transitions are
+//			dropped and counted by Dropped().
+//
+//			After a drop the Binder sends its whole held state once the ring has room for it, on the
+//			next transition or ResetInputs(). It comes between two transitions with player
+//			Sib::PLAYER_RESYNC, the first with pressed set. ActionState replaces its held state with it
+//			without reporting presses, so an action whose release was dropped doesn't stay held. Edges
+//			inside the dropped transitions are still lost.
+//
+//			The ring has to hold a resync with every action held on every device, which is
+//			MaxActions * (SIB_MAX_CONTROLLERS + 1) + 2 transitions. TransitionOutput() reports a
+//			SMALL_RING error for a smaller ring and keeps its previous output. With the defaults a
+//			resync needs 290, with 256 actions the ring has to be built with a larger size.
+//
+//			SDL has to handle events on the thread that created the window, so on most platforms the
+//			input thread is the main thread and the simulation runs on another one. The Binder itself
+//			should only be used from the input thread.
+//
+//		Errors
+//
+//			Error() and ErrorStr() return the code and text of the last error. Every error is also kept
+//			in a ring of the last SIB_ERROR_RING (default 16), ErrorCount() returns how many are kept and
+//			ErrorAt(i) returns them oldest first as a Sib::ErrorRecord, or a NO_ERROR record when i is
+//			out of range. ClearErrors() empties the ring and resets Error() and ErrorStr().
+//
+//			Range errors from the Map, query and controller functions are stored as their code and the
+//			numbers involved, the text is only formatted when ErrorStr() or an error callback asks for
+//			it, so a bad call in a frame loop doesn't allocate. Sib::ErrorText() formats any record.
+//
+//			When an action is a compile time constant, Pressed<Action>(), Released<Action>() and
+//			Held<Action>() check it when compiling and skip the check at run time:
+//
+//				if (binder.Pressed<Action_Jump>()) Jump();
+//
 //		Number of Actions
 //
-//			By default SIB_MAX_ACTIONS is defined as 32. If Sib::Action_t remains typedefed as an
-//			unsigned char, this can be increased up to 256 by editing this file or by macro definition:
+//			Sib::Binder is a typedef of Sib::BasicBinder<SIB_MAX_ACTIONS, Sib::Action_t>. By default
+//			SIB_MAX_ACTIONS is defined as 32 and Action_t is an unsigned char. SIB_MAX_ACTIONS can be
+//			increased up to 256 by editing this file or by macro definition:
+//
+//				g++ -DSIB_MAX_ACTIONS=128 -o my_program {other compile options...}
+//
+//			Binders of other sizes can be used directly. Each one only stores state for its own number
+//			of actions, and the action type has to be big enough to hold every action number:
+//
+//				Sib::BasicBinder<8, unsigned char> menu_binder;
+//				Sib::BasicBinder<4096, unsigned short> game_binder;
+//
+//			Sib::Binder is compiled once in sib.cpp. Other sizes are compiled in whichever file uses
+//			them.
+//
+//		Held Actions and Masks
+//
+//			Held(Sib::Action_t action) is true from the press of an action until its release. It isn't
+//			cleared by ResetInputs(). If more than one input is bound to an action, the action stays held
+//			until all of them are released. Key repeats don't count as extra presses. Held(action, player)
+//			does the same for one controller.
+//
+//			Groups of actions can be tested at once with an ActionMask, a std::bitset with one bit per
+//			action. These compare whole machine words instead of checking one action at a time:
+//
+//				Sib::Binder::ActionMask movement;
+//				movement.set(Action_Up).set(Action_Down).set(Action_Left).set(Action_Right);
+//
+//				if (binder.AnyPressed(movement)) { /* ... */ }
+//				if (binder.AllHeld(movement)) { /* ... */ }
+//
+//			AnyPressed(), AnyReleased(), AnyHeld() and AllHeld() take a mask. PressedMask(),
+//			ReleasedMask() and HeldMask() return the current state as a mask.
+//
+//		Edge Counts and Transitions
+//
+//			PressCount(Sib::Action_t action) and ReleaseCount(Sib::Action_t action) count how many times
+//			an action started and stopped being held since the last ResetInputs(), so two taps in one
+//			frame count as two presses. Key repeats aren't counted.
+//
+//			Transitions() returns every one of those edges in the order they happened, TransitionCount()
+//			returns how many there are. Each Sib::Transition has the action, whether it was a press or a
+//			release, the player (-1 for the combined state of every device) and the timestamp of the SDL
+//			event that caused it:
+//
+//				const Sib::Transition* transitions = binder.Transitions();
+//
+//				for (unsigned int i = 0; i < binder.TransitionCount(); ++i)
+//				{
+//				    if (transitions[i].player == -1 && transitions[i].pressed) Hit(transitions[i].action, transitions[i].timestamp);
+//				}
+//
+//			The list is kept in a buffer owned by the Binder that is reused every frame. Iterating it is
+//			cheaper than checking every action with Pressed() when only a few change per frame.
+//			ResetInputs() also only clears the actions that changed, so its cost doesn't grow with
+//			SIB_MAX_ACTIONS.
+//
+//		Action Callbacks
+//
+//			AddActionCallback(Sib::Action_t action, callback, void* user_data) calls a function from
+//			HandleInput() whenever the action starts or stops being held, instead of checking it with
+//			Pressed() every frame. The callback gets user_data back along with the Sib::Transition:
+//
+//				void OnJump(void* user_data, const Sib::Transition& transition)
+//				{
+//				    if (transition.pressed) static_cast<Player*>(user_data)->Jump();
+//				}
+//
+//				binder.AddActionCallback(Action_Jump, OnJump, &player);
+//
+//			Callbacks are a function pointer and a pointer, so adding one only allocates when the list
+//			grows and calling one never does. They get the combined state of every device by default,
+//			pass a player number as the last argument to only get the transitions of that controller.
+//			RemoveActionCallback() removes a callback with the same action, function and user_data.
+//			Don't add or remove callbacks from inside a callback.
+//
+//		Analog Values
+//
+//			AxisValue(Sib::Axis axis) returns how far an axis direction is pushed, from 0.0 to 1.0. The
+//			deadzone is cut off and the rest of the range is scaled back up to 1.0. With more than one
+//			controller the largest value is returned, AxisValue(axis, player) only checks one.
+//
+//			Value(Sib::Action_t action) does the same for an action. Axes bound to the action give their
+//			analog value and any other input holding the action gives 1.0:
+//
+//				binder.MapGamepadAxis(Sib::Axis::Right_Trigger, Action_Throttle);
+//				binder.MapScancode(SDL_SCANCODE_W, Action_Throttle);
+//				binder.AxisDeadzone(Sib::Axis::Right_Trigger, 10);
+//
+//				float throttle = binder.Value(Action_Throttle);
 //
-//				g++ -DSIB_MAX_ACTION=128 -o my_program {other compile options...}
+//			AxisThresholdLow(), AxisThresholdHigh() and AxisDeadzone() set every axis when called with
+//			just a percentage, or a single axis direction when given a Sib::Axis first. An axis is
+//			pressed when it goes above the high threshold and released when it goes below the low
+//			threshold. Percentages are converted to raw axis values when they are set.
 //
-//			If even more actions are needed, Action_t could be typedefed as an unsigned short.
+//		Batched Input
+//
+//			HandleInputs(const SDL_Event* events, unsigned int count) handles a whole array of events
+//			in one call, which is cheaper than calling HandleInput() per event when many events arrive
+//			each frame.
+//
+//			PollEvents() drains the entire SDL event queue with SDL_PeepEvents() into a buffer owned
+//			by the Binder and passes it to HandleInputs(). The buffer is reused between calls, so it
+//			only allocates when the queue is bigger than it has been before. Non input events (like
+//			SDL_QUIT) are left in the buffer for the program to check:
+//
+//				unsigned int count = binder.PollEvents();
+//				const SDL_Event* events = binder.Events();
+//
+//				for (unsigned int i = 0; i < count; ++i)
+//				{
+//				    if (events[i].type == SDL_QUIT) quit = true;
+//				}
+//
+//		Multiple Controllers
+//
+//			Each controller gets its own slot when SDL sends SDL_CONTROLLERDEVICEADDED, and the slot is
+//			freed again on SDL_CONTROLLERDEVICEREMOVED. Stick and trigger state is tracked per slot,
+//			so two controllers don't interfere with each other. Up to SIB_MAX_CONTROLLERS (default 8)
+//			controllers are tracked at once.
+//
+//			The slot number is the player number. Pressed(action, player) and Released(action, player)
+//			only report actions from that player's controller, while Pressed(action) and
+//			Released(action) still report every device. Player(SDL_JoystickID id) returns the player
+//			number of a controller instance or -1 if it has no slot.
+//
+//				if (binder.Pressed(Action_Jump, 1))
+//				{
+//				    // Player 1 jumped...
+//				}
+//
+//		Binder Pools
+//
+//			A Sib::BinderPool tracks the actions of many players at once, for example on a server that
+//			receives input from every client. Pressed, released and held bits and held counts of every
+//			player are stored in shared arrays one row after another, and players share binding tables
+//			through profiles instead of each having a Binder:
+//
+//				Sib::BinderPool pool;
+//				int profile = pool.AddProfile(binder);
+//				pool.Players(10000);
+//				pool.PlayerProfile(42, profile);
+//
+//			AddProfile() copies the bindings a Binder is editing, without contexts. Keycode binds are
+//			copied as the scancodes they resolve to at the time and don't follow layout changes. A
+//			Binder with chords or sequences isn't added, AddProfile() reports BAD_COMBO and returns -1
+//			instead. Players start on profile 0. HandleEvents(const Sib::PoolEvent* events, std::size_t count)
+//			applies a batch of input presses and releases in one pass, inputs are numbered as described
+//			under Rebinding. Analog axes are sent already thresholded as the Sib::INPUT_CAXIS inputs.
+//
+//				pool.HandleEvents(events.data(), events.size());
+//
+//				if (pool.Pressed(Action_Jump, 42)) ...
+//
+//				pool.ResetInputs();
+//
+//			Changing a player's profile or calling ResetPlayer() lets go of everything they held. Bad
+//			players, profiles, actions and events are reported through Error(), ErrorStr() and
+//			ErrorCallback() the same way as on a Binder, events that fail are skipped.
+//
+//		Snapshots
+//
+//			A Sib::ActionSnapshot holds the pressed, released and held state and the Value() of every
+//			action for one tick, for sending a player's input over the network. Capture() copies it
+//			from a Binder and Encode() writes the difference from the previous tick's snapshot:
+//
+//				Sib::ActionSnapshot snapshots[2];
+//				std::vector<Uint8> packet;
+//
+//				snapshots[tick & 1].Capture(binder);
+//				snapshots[tick & 1].Encode(snapshots[~tick & 1], packet);
+//
+//			Decode() on the receiving side rebuilds the snapshot from the same previous one, and returns
+//			false if the data is cut short. Both sides start from an empty snapshot:
+//
+//				if (received[tick & 1].Decode(received[~tick & 1], packet.data(), packet.size()))
+//				{
+//				    if (received[tick & 1].Pressed(Action_Jump)) ...
+//				}
+//
+//			A tick where nothing changes is one byte. Sparse sets of actions are written as a list,
+//			dense ones as a bit per action. Values are kept to 16 bits and only sent for actions whose
+//			value isn't 0 or 1 matching the held bit.
 //
 //		Multiple Actions per Input
 //
-//			Only one action can be mapped to an input. This could be limiting for applications that have
-//			more complex requirements. A simple solution is to use more than one Sib::Binder and just
-//			send input events to some or all of them as necessary.
+//			Calling a MapXXXX() function again for the same input adds another action instead of
+//			replacing the first one. All of the actions bound to an input are pressed and released
+//			together:
+//
+//				binder.MapScancode(SDL_SCANCODE_SPACE, Action_Jump);
+//				binder.MapScancode(SDL_SCANCODE_SPACE, Action_Confirm);
+//
+//			The UnmapXXXX() functions remove every action from the input. To change the action of an
+//			input, unmap it first and then map the new action.
 
 #pragma once
 #include <unordered_map>
+#include <atomic>
 #include <bitset>
+#include <cstddef>
 #include <filesystem>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 #include <SDL.h>
 
 #ifndef SIB_MAX_ACTIONS
 #define SIB_MAX_ACTIONS 32
 #endif
 
+#ifndef SIB_MAX_CONTROLLERS
+#define SIB_MAX_CONTROLLERS 8
+#endif
+
+#ifndef SIB_EVENT_CHUNK
+#define SIB_EVENT_CHUNK 256
+#endif
+
+#ifndef SIB_RING_SIZE
+#define SIB_RING_SIZE 1024
+#endif
+
+#ifndef SIB_MAX_COMBOS
+#define SIB_MAX_COMBOS 32
+#endif
+
+#ifndef SIB_COMBO_STEPS
+#define SIB_COMBO_STEPS 8
+#endif
+
+#ifndef SIB_MAX_CONTEXTS
+#define SIB_MAX_CONTEXTS 16
+#endif
+
+#ifndef SIB_ERROR_RING
+#define SIB_ERROR_RING 16
+#endif
+
 namespace Sib
 {
 	typedef int Error_t;
@@ -133,13 +585,31 @@ namespace Sib
 	constexpr Error_t NO_SCANCODE = 10;
 	constexpr Error_t BAD_COMMAND = 11;
 	constexpr Error_t OPEN_FILE = 12;
+	constexpr Error_t BAD_SCANCODE = 13;
+	constexpr Error_t BAD_CBUTTON = 14;
+	constexpr Error_t BAD_PLAYER = 15;
+	constexpr Error_t NO_CONTROLLER_SLOT = 16;
+	constexpr Error_t BAD_PERCENT = 17;
+	constexpr Error_t BAD_COMPILED = 18;
+	constexpr Error_t BAD_RECORD = 19;
+	constexpr Error_t BAD_COMBO = 20;
+	constexpr Error_t BAD_CONTEXT = 21;
+	constexpr Error_t BAD_INPUT = 22;
+	constexpr Error_t BAD_PROFILE = 23;
+	constexpr Error_t SMALL_RING = 24;
 
-	struct ActionBind
+	// An error kept as its code and the numbers that caused it, the text is only built when asked
+	// for. Errors from reading files only keep their code, ErrorStr() has their full text.
+	struct ErrorRecord
 	{
-		bool exists = false;
-		Action_t action;
+		Error_t error;
+		Sint64 value;
+		Sint64 limit;
 	};
 
+	// Writes the text of an error to buffer like snprintf() and returns the length it needed
+	int ErrorText(const ErrorRecord& record, char* buffer, std::size_t size);
+
 	enum class Axis
 	{
 		Left_X_Pos,
@@ -154,70 +624,676 @@ namespace Sib
 		Right_Trigger
 	};
 
-	class Binder
+	constexpr unsigned int AXIS_COUNT = 10;
+
+	// Config file commands
+	enum class Command
+	{
+		Scancode,
+		Keycode,
+		MouseButton,
+		GamepadButton,
+		GamepadAxis,
+		WheelUp,
+		WheelDown,
+		WheelLeft,
+		WheelRight,
+		Chord,
+		Sequence,
+		Unmap_Scancode,
+		Unmap_Keycode,
+		Unmap_MouseButton,
+		Unmap_GamepadButton,
+		Unmap_GamepadAxis,
+		Unmap_WheelUp,
+		Unmap_WheelDown,
+		Unmap_WheelLeft,
+		Unmap_WheelRight,
+		Unmap_Combo
+	};
+
+	// Every input that can be bound has an index into the binding tables. Axis inputs are in the
+	// same order as Sib::Axis and wheel inputs are left, right, down, up.
+	constexpr unsigned int INPUT_SCANCODE = 0;
+	constexpr unsigned int INPUT_CBUTTON = INPUT_SCANCODE + SDL_NUM_SCANCODES;
+	constexpr unsigned int INPUT_CAXIS = INPUT_CBUTTON + SDL_CONTROLLER_BUTTON_MAX;
+	constexpr unsigned int INPUT_MBUTTON = INPUT_CAXIS + AXIS_COUNT;
+	constexpr unsigned int INPUT_WHEEL = INPUT_MBUTTON + 5;
+	constexpr unsigned int INPUT_COUNT = INPUT_WHEEL + 4;
+
+	constexpr unsigned int COMBO_STEP_INPUTS = 4;
+
+	// A chord or sequence. Each step is a set of inputs that have to be held down together, a chord
+	// is a single step that keeps its action held for as long as the inputs are.
+	template<typename ActionT>
+	struct BasicCombo
+	{
+		Uint16 inputs[SIB_COMBO_STEPS][COMBO_STEP_INPUTS];
+		Uint8 step_size[SIB_COMBO_STEPS];
+		Uint8 step_count;
+		bool chord;
+		Uint32 window;
+		ActionT action;
+	};
+
+	// A keycode bind and the scancode the keycode had in the keyboard layout when it was last resolved
+	template<typename ActionT>
+	struct BasicKeycodeBind
+	{
+		SDL_Keycode keycode;
+		SDL_Scancode scancode;
+		ActionT action;
+		// Set if the table entry for scancode and action exists because of this bind, an explicit
+		// scancode bind or another keycode bind owns it otherwise
+		bool owner;
+	};
+
+	// The actions bound to input i are actions[offsets[i]] up to (not including)
+	// actions[offsets[i + 1]]. Combos that use input i are indexed the same way by combo_offsets, and
+	// the inputs bound to action a by action_offsets, which stays empty until something is bound.
+	template<typename ActionT>
+	struct BasicBindings
+	{
+		Uint32 offsets[INPUT_COUNT + 1] = {};
+		std::vector<ActionT> actions;
+		std::vector<BasicCombo<ActionT>> combos;
+		Uint32 combo_offsets[INPUT_COUNT + 1] = {};
+		std::vector<Uint16> combo_index;
+		std::vector<Uint32> action_offsets;
+		std::vector<Uint16> action_inputs;
+		std::vector<BasicKeycodeBind<ActionT>> keycodes;
+	};
+
+	// Compiled profiles are this header followed by the binding offsets and actions, in the byte order
+	// of the machine that saved them. "SIBC" when read as little endian.
+	constexpr Uint32 COMPILED_MAGIC = 0x43424953;
+	constexpr Uint32 COMPILED_VERSION = 2;
+
+	struct CompiledHeader
+	{
+		Uint32 magic;
+		Uint32 version;
+		Uint32 max_actions;
+		Uint32 action_size;
+		Uint32 input_count;
+		Uint32 action_count;
+		Uint32 combo_size;
+		Uint32 combo_count;
+	};
+
+	// The fields of an SDL event that HandleInput() reads. Code is the scancode, button or axis and
+	// value is the pressed state or axis value. Mouse wheel events keep x in code and y in value.
+	// Type 0 marks a call to ResetInputs().
+	struct RecordedEvent
+	{
+		Uint32 timestamp;
+		Uint32 type;
+		Sint32 which;
+		Sint16 code;
+		Sint16 value;
+	};
+
+	// Event records are this header followed by the events, in the byte order of the machine that
+	// saved them. "SIBR" when read as little endian.
+	constexpr Uint32 RECORD_MAGIC = 0x52424953;
+	constexpr Uint32 RECORD_VERSION = 1;
+
+	struct RecordHeader
+	{
+		Uint32 magic;
+		Uint32 version;
+		Uint32 event_size;
+		Uint32 event_count;
+	};
+
+	// Size of the open addressed instance id -> slot table. A power of two at least twice
+	// SIB_MAX_CONTROLLERS, so probes stay short.
+	constexpr unsigned int ControllerTableSize(unsigned int size = 1)
+	{
+		return size >= SIB_MAX_CONTROLLERS * 2 ? size : ControllerTableSize(size * 2);
+	}
+
+	constexpr unsigned int CONTROLLER_TABLE_SIZE = ControllerTableSize();
+
+	// Name lookups used by the config file reader. The FromString functions return false if the string
+	// doesn't name anything, the ToString functions return an empty string if the value has no name.
+	bool ScancodeFromString(std::string_view str, SDL_Scancode& scancode);
+	bool KeycodeFromString(std::string_view str, SDL_Keycode& keycode);
+	bool MouseButtonFromString(std::string_view str, Uint8& button);
+	bool GamepadButtonFromString(std::string_view str, Uint8& button);
+	bool AxisFromString(std::string_view str, Sib::Axis& axis);
+	bool CommandFromString(std::string_view str, Sib::Command& command);
+	std::string_view ScancodeToString(SDL_Scancode scancode);
+	std::string_view KeycodeToString(SDL_Keycode keycode);
+	std::string_view MouseButtonToString(Uint8 button);
+	std::string_view GamepadButtonToString(Uint8 button);
+	std::string_view AxisToString(Sib::Axis axis);
+	std::string_view CommandToString(Sib::Command command);
+
+	// The config file command that maps an input and the name of the input. The name is empty for
+	// the wheel commands, which don't have one.
+	Sib::Command InputToString(unsigned int input, std::string_view& name);
+
+	// An action starting or stopping being held. Player -1 is the combined state of every device,
+	// other players are the state of that controller alone.
+	template<typename ActionT>
+	struct BasicTransition
+	{
+		Uint32 timestamp;
+		ActionT action;
+		bool pressed;
+		Sint8 player;
+	};
+
+	// Player of the two transitions around a resync of the held state, pressed is set on the first
+	constexpr Sint8 PLAYER_RESYNC = -2;
+
+	// Action strings interned into one buffer and found with a single probe of an open addressing
+	// table. Views returned by Name() are invalidated by the next Set().
+	template<typename ActionT>
+	class BasicActionNames
+	{
+		struct Entry
+		{
+			Uint32 offset;
+			Uint32 length;
+			Uint32 hash;
+			ActionT action;
+		};
+
+		std::string pool;
+		std::vector<Entry> entries;
+		std::vector<Uint32> slots;
+
+		static Uint32 Hash(std::string_view name);
+		Uint32 Slot(std::string_view name, Uint32 hash);
+		void Grow();
+	public:
+		void Set(std::string_view name, ActionT action);
+		bool Find(std::string_view name, ActionT& action);
+		unsigned int Count();
+		std::string_view Name(unsigned int i);
+		ActionT Action(unsigned int i);
+	};
+
+	// Lock free ring for handing transitions from one producer thread to one consumer thread
+	template<typename ActionT>
+	class BasicTransitionRing
+	{
+		std::vector<BasicTransition<ActionT>> buffer;
+		Uint32 mask;
+
+		// Each side keeps its own copy of the other side's index, so the shared cache lines are only
+		// read when the ring looks full or empty
+		alignas(64) std::atomic<Uint32> tail = 0;
+		Uint32 head_cache = 0;
+		alignas(64) std::atomic<Uint32> head = 0;
+		Uint32 tail_cache = 0;
+		alignas(64) std::atomic<Uint32> dropped = 0;
+
+	public:
+		BasicTransitionRing(Uint32 size = SIB_RING_SIZE);
+		BasicTransitionRing(const BasicTransitionRing&) = delete;
+		BasicTransitionRing& operator=(const BasicTransitionRing&) = delete;
+		bool Push(const BasicTransition<ActionT>& transition);
+		bool Pop(BasicTransition<ActionT>& transition);
+		Uint32 Capacity();
+		Uint32 Free();
+		Uint32 Dropped();
+	};
+
+	// Pressed/released/held state rebuilt from transitions on the consuming thread
+	template<std::size_t MaxActions, typename ActionT>
+	class BasicActionState
 	{
+	public:
+		typedef std::bitset<MaxActions> ActionMask;
+
 	private:
-		std::unordered_map<std::string,Sib::Action_t> action_strings;
-		std::unordered_map<SDL_Keycode,Sib::Action_t> keys;
-		std::unordered_map<SDL_Scancode,Sib::Action_t> scancodes;
-		std::unordered_map<Uint8,Sib::Action_t> cbuttons;
+		ActionMask pressed;
+		ActionMask released;
+		ActionMask held;
+		ActionMask player_pressed[SIB_MAX_CONTROLLERS];
+		ActionMask player_released[SIB_MAX_CONTROLLERS];
+		ActionMask player_held[SIB_MAX_CONTROLLERS];
+		bool resyncing = false;
+
+	public:
+		void Apply(const BasicTransition<ActionT>& transition);
+		unsigned int Consume(BasicTransitionRing<ActionT>& ring);
+		void ResetInputs();
+		bool Pressed(ActionT action);
+		bool Released(ActionT action);
+		bool Held(ActionT action);
+		bool Pressed(ActionT action, int player);
+		bool Released(ActionT action, int player);
+		bool Held(ActionT action, int player);
+		const ActionMask& PressedMask();
+		const ActionMask& ReleasedMask();
+		const ActionMask& HeldMask();
+	};
+
+	template<std::size_t MaxActions, typename ActionT>
+	class BasicWatcher;
+
+	template<std::size_t MaxActions, typename ActionT>
+	class BasicBinderPool;
+
+	template<std::size_t MaxActions, typename ActionT>
+	class BasicActionSnapshot;
+
+	// A press or release of an input, numbered like Sib::INPUT_SCANCODE + scancode, by one player of
+	// a BasicBinderPool
+	struct PoolEvent
+	{
+		Uint32 player;
+		Uint16 input;
+		bool pressed;
+	};
+
+	template<std::size_t MaxActions, typename ActionT>
+	class BasicBinder
+	{
+		static_assert(std::is_integral<ActionT>::value && std::is_unsigned<ActionT>::value,
+			"ActionT must be an unsigned integer type");
+		static_assert(MaxActions > 0, "MaxActions must be at least 1");
+		static_assert(MaxActions - 1 <= std::numeric_limits<ActionT>::max(),
+			"ActionT is too small to hold MaxActions actions");
+		static_assert(SIB_MAX_CONTEXTS < 32, "Active contexts are kept in a 32 bit mask");
+
+	public:
+		typedef std::bitset<MaxActions> ActionMask;
+		typedef void (ActionCallback_t)(void* user_data, const BasicTransition<ActionT>& transition);
+
+	private:
+		typedef Sib::BasicBindings<ActionT> Bindings;
+		typedef Sib::BasicCombo<ActionT> Combo;
+		typedef Sib::BasicTransitionRing<ActionT> TransitionRing_t;
+
+		// Progress through a sequence, or whether a chord is down
+		struct ComboState
+		{
+			Uint32 start = 0;
+			Uint8 step = 0;
+			bool active = false;
+		};
+
+		// Hysteresis and action state for one connected controller. Slot ids double as player numbers.
+		struct ControllerState
+		{
+			SDL_JoystickID id = -1;
+			Sint16 axis_value[SDL_CONTROLLER_AXIS_MAX] = {};
+			std::bitset<INPUT_COUNT> inputs_held;
+			ActionMask pressed;
+			ActionMask released;
+			ActionMask held;
+			Uint8 held_count[MaxActions] = {};
+			ComboState combo_state[SIB_MAX_COMBOS];
+			std::vector<ActionT> changed_actions;
+		};
+
+		// Thresholds are kept as percentages for the getters and as raw axis values for
+		// HandleGamepadAxis(), so events never have to be scaled
+		struct AxisConfig
+		{
+			unsigned char threshold_low = 33;
+			unsigned char threshold_high = 66;
+			unsigned char deadzone = 0;
+			Sint16 raw_low = 33 * 327;
+			Sint16 raw_high = 67 * 327 - 1;
+			Sint16 raw_deadzone = 0;
+			float scale = 1.0f / 32767;
+		};
+
+		// Binds that can be pushed on top of the default ones. A consuming context hides the binds of
+		// lower contexts for every input it binds.
+		struct Context
+		{
+			std::string name;
+			int priority;
+			bool consume;
+			Bindings bindings;
+		};
+
+		struct ActionCallback
+		{
+			ActionCallback_t* callback;
+			void* user_data;
+			int player;
+		};
+
+		// A keycode chord or sequence read by a BasicWatcher, its keycodes are looked up on the main
+		// thread
+		struct DeferredCombo
+		{
+			Combo combo;
+			SDL_Keycode keycodes[SIB_COMBO_STEPS][COMBO_STEP_INPUTS];
+			unsigned int line;
+		};
+
+		// Tables parsed by a BasicWatcher, waiting for ResetInputs() to swap them in. A reload with
+		// errors only carries the error.
+		struct StagedBindings
+		{
+			Bindings bindings;
+			std::vector<DeferredCombo> combos;
+			Error_t error = NO_ERROR;
+			std::string error_str;
+		};
+
+		friend class BasicWatcher<MaxActions, ActionT>;
+		friend class BasicBinderPool<MaxActions, ActionT>;
+		friend class BasicActionSnapshot<MaxActions, ActionT>;
+
+		BasicActionNames<ActionT> action_strings;
+		ActionMask named_actions;
+		std::size_t next_auto_action = 0;
+		bool auto_actions = false;
 		ErrorCallback_t* error_callback = 0;
-		ActionBind left_trigger;
-		ActionBind right_trigger;
-		ActionBind caxispos[4];
-		ActionBind caxisneg[4];
-		ActionBind mbuttons[5];
-		ActionBind wheels[4];
-		std::bitset<SIB_MAX_ACTIONS> pressed;
-		std::bitset<SIB_MAX_ACTIONS> released;
+		Bindings bindings;
+		Bindings* edit_bindings = &bindings;
+		const Bindings* active_bindings = &bindings;
+		std::vector<std::unique_ptr<Context>> contexts;
+		std::vector<int> context_stack;
+		Uint32 context_mask = 0;
+		std::unordered_map<Uint32, Bindings> merged_bindings;
+		bool merged_dirty = false;
+		std::bitset<INPUT_COUNT> inputs_held;
+		ActionMask pressed;
+		ActionMask released;
+		ActionMask held;
+		Uint16 held_count[MaxActions] = {};
+		ComboState combo_state[SIB_MAX_COMBOS];
+		AxisConfig axis_config[AXIS_COUNT];
+		ControllerState controllers[SIB_MAX_CONTROLLERS];
+		Sint8 controller_table[CONTROLLER_TABLE_SIZE];
+		std::atomic<StagedBindings*> staged_bindings = nullptr;
+		// Set on a BasicWatcher's parser, which leaves keycodes unresolved since SDL can only look
+		// them up on the main thread
+		StagedBindings* staging = nullptr;
+		TransitionRing_t* transition_output = nullptr;
+		bool transition_resync = false;
+		// A resync is the held state of every device and controller between two markers
+		static constexpr std::size_t RESYNC_SIZE = MaxActions * (SIB_MAX_CONTROLLERS + 1) + 2;
+		Uint32 callback_offsets[MaxActions + 1] = {};
+		std::vector<ActionCallback> callbacks;
+		std::vector<BasicTransition<ActionT>> transitions;
+		std::vector<ActionT> changed_actions;
+		Uint16 press_count[MaxActions] = {};
+		Uint16 release_count[MaxActions] = {};
+		Uint32 event_timestamp = 0;
+		std::vector<RecordedEvent>* event_record = nullptr;
+		std::vector<SDL_Event> event_buffer;
+		std::vector<char> file_buffer;
 		std::string error_str;
+		ErrorRecord error_ring[SIB_ERROR_RING] = {};
+		Uint32 error_total = 0;
+		char error_text[96] = {};
+		bool error_text_stale = false;
+		bool error_is_record = false;
 		unsigned char axis_threshold_high = 66;
 		unsigned char axis_threshold_low = 33;
 		Error_t error = NO_ERROR;
-		bool axis_state_lt = false;
-		bool axis_state_rt = false;
-		unsigned char axis_state = 0;
+		unsigned int event_count = 0;
 
 		void SetError(Error_t error, const std::string& error_str);
+		void SetError(Error_t error, Sint64 value, Sint64 limit);
+		void Bind(unsigned int input, ActionT action);
+		void Unbind(unsigned int input);
+		void Unbind(unsigned int input, ActionT action);
+		void ResolveKeycodes();
+		void AddTransition(ActionT action, bool pressed, int player);
+		void SendResync();
+		void PressAction(ActionT action, bool repeat);
+		void ReleaseAction(ActionT action, bool was_held);
+		void PressAction(ActionT action, bool repeat, ControllerState& controller);
+		void ReleaseAction(ActionT action, bool was_held, ControllerState& controller);
+		static void BuildComboIndex(Bindings& bindings);
+		static void BuildActionIndex(Bindings& bindings);
+		bool ComboStep(Combo& combo);
+		bool ComboInput(Combo& combo, unsigned int input);
+		void AddCombo(Combo& combo, ActionT action);
+		void ResetCombos(bool release);
+		bool ComboStepHeld(const Combo& combo, unsigned int step, unsigned int input, const std::bitset<INPUT_COUNT>& held_inputs);
+		void PressCombos(unsigned int input, const std::bitset<INPUT_COUNT>& held_inputs, ComboState* state, ControllerState* controller);
+		void ReleaseCombos(unsigned int input, ComboState* state, ControllerState* controller);
+		void PressInput(unsigned int input);
+		void ReleaseInput(unsigned int input);
+		void PressInput(unsigned int input, ControllerState& controller);
+		void ReleaseInput(unsigned int input, ControllerState& controller);
+		void BindKeycode(BasicKeycodeBind<ActionT>& bind);
+		void UnbindKeycode(BasicKeycodeBind<ActionT>& bind);
+		void RebindHeldInput(unsigned int input, ActionT action, bool press);
+		int ControllerSlot(SDL_JoystickID id);
+		int AddController(SDL_JoystickID id);
+		void RemoveController(SDL_JoystickID id);
+		void SwapStagedBindings();
+		Bindings& ContextBindings(int context);
+		void MergeContexts(Uint32 mask, Bindings& merged);
+		void ReleaseChangedInputs(const Bindings& next);
+		void UpdateContexts();
+		bool ValidateContext(int context);
+		bool ValidateInput(unsigned int input);
+		void RecordEvent(const SDL_Event& event);
 		void HandleKey(const SDL_KeyboardEvent& event);
 		void HandleGamepadButton(const SDL_ControllerButtonEvent& event);
-		void HandleGamepadTrigger(const SDL_ControllerAxisEvent& event);
+		void UpdateAxisConfig(AxisConfig& config);
+		void UpdateAxis(unsigned int axis, int magnitude, ControllerState& controller);
+		float AxisValue(unsigned int axis, const ControllerState& controller);
+		float Value(ActionT action, const ControllerState& controller, unsigned int& axis_holds);
 		void HandleGamepadAxis(const SDL_ControllerAxisEvent& event);
 		void HandleMouseButton(const SDL_MouseButtonEvent& event);
 		void HandleMouseWheel(const SDL_MouseWheelEvent& event);
-		bool ValidateAction(Sib::Action_t action);
-		bool ValidateActionStr(const std::string& action_str);
-		void ReadLine(const std::string& line, unsigned int n);
+		bool ValidateAction(ActionT action);
+		bool ValidateScancode(SDL_Scancode scancode);
+		bool ValidateGamepadButton(Uint8 button);
+		bool ValidatePlayer(int player);
+		bool ValidateAxis(Sib::Axis axis);
+		bool ValidatePercent(unsigned char value);
+		bool ValidateActionStr(std::string_view action_str, ActionT& action);
+		bool ReadCombo(std::string_view kind_str, std::string_view str, Combo& combo, unsigned int n, SDL_Keycode (*keycodes)[COMBO_STEP_INPUTS]);
+		void ReadLine(std::string_view line, unsigned int n);
+		bool LoadFile(const std::filesystem::path& path, std::size_t& size);
 	public:
+		BasicBinder();
+		~BasicBinder();
 		void ErrorCallback(ErrorCallback_t*);
+		void TransitionOutput(TransitionRing_t* ring);
+		void AddActionCallback(ActionT action, ActionCallback_t* callback, void* user_data, int player = -1);
+		void RemoveActionCallback(ActionT action, ActionCallback_t* callback, void* user_data);
+		void RecordEvents(std::vector<RecordedEvent>* record);
 		const char* ErrorStr();
 		Error_t Error();
-		void MapScancode(SDL_Scancode scancode, Sib::Action_t action);
+		unsigned int ErrorCount();
+		const ErrorRecord& ErrorAt(unsigned int i);
+		void ClearErrors();
+		void MapScancode(SDL_Scancode scancode, ActionT action);
 		void UnmapScancode(SDL_Scancode scancode);
-		void MapGamepadButton(Uint8 button, Sib::Action_t action);
+		void MapKeycode(SDL_Keycode keycode, ActionT action);
+		void UnmapKeycode(SDL_Keycode keycode);
+		void MapGamepadButton(Uint8 button, ActionT action);
 		void UnmapGamepadButton(Uint8 button);
-		void MapGamepadAxis(Sib::Axis axis, Sib::Action_t action);
+		void MapGamepadAxis(Sib::Axis axis, ActionT action);
 		void UnmapGamepadAxis(Sib::Axis axis);
-		void MapMouseButton(Uint8 button, Sib::Action_t action);
+		void MapMouseButton(Uint8 button, ActionT action);
 		void UnmapMouseButton(Uint8 button);
-		void MapMouseWheelUp(Sib::Action_t action);
+		void MapMouseWheelUp(ActionT action);
 		void UnmapMouseWheelUp();
-		void MapMouseWheelDown(Sib::Action_t action);
+		void MapMouseWheelDown(ActionT action);
 		void UnmapMouseWheelDown();
-		void MapMouseWheelLeft(Sib::Action_t action);
+		void MapMouseWheelLeft(ActionT action);
 		void UnmapMouseWheelLeft();
-		void MapMouseWheelRight(Sib::Action_t action);
+		void MapMouseWheelRight(ActionT action);
 		void UnmapMouseWheelRight();
+		void MapScancodeChord(std::initializer_list<SDL_Scancode> scancodes, ActionT action);
+		void MapGamepadButtonChord(std::initializer_list<Uint8> buttons, ActionT action);
+		void MapScancodeSequence(std::initializer_list<std::initializer_list<SDL_Scancode>> steps, Uint32 window, ActionT action);
+		void MapGamepadButtonSequence(std::initializer_list<std::initializer_list<Uint8>> steps, Uint32 window, ActionT action);
+		void UnmapCombos(ActionT action);
+		int AddContext(const std::string& name, int priority, bool consume = true);
+		int FindContext(std::string_view name);
+		void EditContext(int context);
+		void PushContext(int context);
+		void PopContext();
+		bool ContextActive(int context);
+		const ActionT* InputActions(unsigned int input, unsigned int& count);
+		const Uint16* ActionInputs(ActionT action, unsigned int& count);
 		void AxisThresholdLow(unsigned char value);
 		unsigned char AxisThresholdLow();
 		void AxisThresholdHigh(unsigned char value);
 		unsigned char AxisThresholdHigh();
-		bool Pressed(Sib::Action_t action);
-		bool Released(Sib::Action_t action);
+		void AxisThresholdLow(Sib::Axis axis, unsigned char value);
+		unsigned char AxisThresholdLow(Sib::Axis axis);
+		void AxisThresholdHigh(Sib::Axis axis, unsigned char value);
+		unsigned char AxisThresholdHigh(Sib::Axis axis);
+		void AxisDeadzone(unsigned char value);
+		void AxisDeadzone(Sib::Axis axis, unsigned char value);
+		unsigned char AxisDeadzone(Sib::Axis axis);
+		float AxisValue(Sib::Axis axis);
+		float AxisValue(Sib::Axis axis, int player);
+		float Value(ActionT action);
+		float Value(ActionT action, int player);
+		bool Pressed(ActionT action);
+		bool Released(ActionT action);
+		bool Pressed(ActionT action, int player);
+		bool Released(ActionT action, int player);
+		bool Held(ActionT action);
+		bool Held(ActionT action, int player);
+		template<ActionT Action> bool Pressed();
+		template<ActionT Action> bool Released();
+		template<ActionT Action> bool Held();
+		unsigned int PressCount(ActionT action);
+		unsigned int ReleaseCount(ActionT action);
+		const BasicTransition<ActionT>* Transitions();
+		unsigned int TransitionCount();
+		bool AnyPressed(const ActionMask& mask);
+		bool AnyReleased(const ActionMask& mask);
+		bool AnyHeld(const ActionMask& mask);
+		bool AllHeld(const ActionMask& mask);
+		const ActionMask& PressedMask();
+		const ActionMask& ReleasedMask();
+		const ActionMask& HeldMask();
+		int Player(SDL_JoystickID id);
 		void HandleInput(const SDL_Event& event);
+		void HandleInputs(const SDL_Event* events, unsigned int count);
+		unsigned int PollEvents();
+		const SDL_Event* Events();
 		void ResetInputs();
+		void ReplayEvent(const RecordedEvent& event);
+		void ReplayEvents(const RecordedEvent* events, std::size_t count);
+		void SaveRecord(std::filesystem::path path, const std::vector<RecordedEvent>& record);
+		void LoadRecord(std::filesystem::path path, std::vector<RecordedEvent>& record);
 		void ReadFile(std::filesystem::path path);
-		void ActionSetString(Sib::Action_t action, const std::string& actions_str);
+		void ReadString(std::string_view text);
+		void SaveFile(std::filesystem::path path);
+		void SaveCompiled(std::filesystem::path path);
+		void LoadCompiled(std::filesystem::path path);
+		void ActionSetString(ActionT action, std::string_view action_str);
+		bool ActionFromString(std::string_view action_str, ActionT& action);
+		void AutoActions(bool enable);
 	};
+
+	// Input state of many players in flat arrays with one row per player. Players share binding
+	// tables through profiles copied from a Binder.
+	template<std::size_t MaxActions, typename ActionT>
+	class BasicBinderPool
+	{
+		typedef Sib::BasicBindings<ActionT> Bindings;
+
+		static constexpr std::size_t ACTION_WORDS = (MaxActions + 63) / 64;
+		static constexpr std::size_t INPUT_WORDS = (INPUT_COUNT + 63) / 64;
+
+		std::vector<Bindings> profiles;
+		std::vector<Uint16> player_profile;
+		std::vector<Uint64> inputs_held;
+		std::vector<Uint64> pressed;
+		std::vector<Uint64> released;
+		std::vector<Uint64> held;
+		std::vector<Uint16> held_count;
+		unsigned int player_count = 0;
+		Error_t error = NO_ERROR;
+		ErrorRecord error_record = {};
+		std::string error_str;
+		char error_text[96] = {};
+		bool error_is_record = false;
+		bool error_text_stale = false;
+		ErrorCallback_t* error_callback = nullptr;
+
+		void SetError(Error_t error, const std::string& error_str);
+		void SetError(Error_t error, Sint64 value, Sint64 limit);
+		bool ValidateAction(ActionT action);
+		bool ValidatePlayer(unsigned int player);
+
+	public:
+		Error_t Error();
+		const char* ErrorStr();
+		void ErrorCallback(ErrorCallback_t*);
+		int AddProfile(BasicBinder<MaxActions, ActionT>& binder);
+		void Players(unsigned int count);
+		unsigned int Players();
+		void PlayerProfile(unsigned int player, int profile);
+		int PlayerProfile(unsigned int player);
+		void ResetPlayer(unsigned int player);
+		void HandleEvents(const PoolEvent* events, std::size_t count);
+		void ResetInputs();
+		bool Pressed(ActionT action, unsigned int player);
+		bool Released(ActionT action, unsigned int player);
+		bool Held(ActionT action, unsigned int player);
+	};
+
+	// The pressed, released and held bits and analog values of a Binder for one tick, written as a
+	// bit packed difference from the previous tick
+	template<std::size_t MaxActions, typename ActionT>
+	class BasicActionSnapshot
+	{
+	public:
+		typedef std::bitset<MaxActions> ActionMask;
+
+	private:
+		static constexpr unsigned int BitWidth(std::size_t value)
+		{
+			return value ? 1 + BitWidth(value >> 1) : 0;
+		}
+
+		static constexpr unsigned int INDEX_BITS = MaxActions > 1 ? BitWidth(MaxActions - 1) : 1;
+		static constexpr unsigned int COUNT_BITS = BitWidth(MaxActions);
+
+		ActionMask pressed;
+		ActionMask released;
+		ActionMask held;
+		ActionMask analog;
+		Uint16 values[MaxActions] = {};
+
+		static void WriteBits(std::vector<Uint8>& out, std::size_t& bit, Uint32 value, unsigned int count);
+		static bool ReadBits(const Uint8* data, std::size_t size, std::size_t& bit, Uint32& value, unsigned int count);
+		static void WriteMask(std::vector<Uint8>& out, std::size_t& bit, const ActionMask& mask);
+		static bool ReadMask(const Uint8* data, std::size_t size, std::size_t& bit, ActionMask& mask);
+	public:
+		void Capture(BasicBinder<MaxActions, ActionT>& binder);
+		void Encode(const BasicActionSnapshot& previous, std::vector<Uint8>& out);
+		bool Decode(const BasicActionSnapshot& previous, const Uint8* data, std::size_t size);
+		bool Pressed(ActionT action);
+		bool Released(ActionT action);
+		bool Held(ActionT action);
+		float Value(ActionT action);
+	};
+
+	typedef BasicBinder<SIB_MAX_ACTIONS, Action_t> Binder;
+	typedef BasicTransition<Action_t> Transition;
+	typedef BasicTransitionRing<Action_t> TransitionRing;
+	typedef BasicActionState<SIB_MAX_ACTIONS, Action_t> ActionState;
+	typedef BasicBinderPool<SIB_MAX_ACTIONS, Action_t> BinderPool;
+	typedef BasicActionSnapshot<SIB_MAX_ACTIONS, Action_t> ActionSnapshot;
 }
 
+#include "sib_binder.hpp"
+#include "sib_readfile.hpp"
+#include "sib_ring.hpp"
+#include "sib_record.hpp"
+#include "sib_names.hpp"
+#include "sib_pool.hpp"
+#include "sib_snapshot.hpp"
+
+// The default Binder is compiled once in sib.cpp
+extern template class Sib::BasicBinder<SIB_MAX_ACTIONS, Sib::Action_t>;
+
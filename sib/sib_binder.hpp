@@ -0,0 +1,2262 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "sib.hpp"
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+
+template<std::size_t MaxActions, typename ActionT>
+Sib::BasicBinder<MaxActions, ActionT>::BasicBinder()
+{
+	for (unsigned int i = 0; i < CONTROLLER_TABLE_SIZE; ++i)
+	{
+		controller_table[i] = -1;
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+Sib::BasicBinder<MaxActions, ActionT>::~BasicBinder()
+{
+	delete staged_bindings.load();
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::SetError(Error_t error_in, const std::string& error_str_in)
+{
+	error = error_in;
+	error_str = error_str_in;
+	error_is_record = false;
+	error_ring[error_total++ % SIB_ERROR_RING] = {error, 0, 0};
+	if (error_callback) error_callback(error, error_str.c_str());
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::SetError(Error_t error_in, Sint64 value, Sint64 limit)
+{
+	error = error_in;
+	error_is_record = true;
+	error_text_stale = true;
+	error_ring[error_total++ % SIB_ERROR_RING] = {error, value, limit};
+	if (error_callback) error_callback(error, ErrorStr());
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::AddTransition(ActionT action, bool pressed, int player)
+{
+	BasicTransition<ActionT> transition;
+	transition.timestamp = event_timestamp;
+	transition.action = action;
+	transition.pressed = pressed;
+	transition.player = (Sint8)player;
+	transitions.push_back(transition);
+
+	if (transition_output)
+	{
+		if (transition_resync) SendResync();
+		if (!transition_output->Push(transition)) transition_resync = true;
+	}
+
+	Uint32 end = callback_offsets[action + 1];
+
+	for (Uint32 i = callback_offsets[action]; i < end; ++i)
+	{
+		const ActionCallback& callback = callbacks[i];
+		if (callback.player == player) callback.callback(callback.user_data, transition);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::SendResync()
+{
+	// Half a held state would be wrong, so it waits until the largest one fits. Checking against
+	// that keeps this cheap while the consumer is behind, and TransitionOutput() makes sure it can.
+	if (transition_output->Free() < RESYNC_SIZE) return;
+	transition_resync = false;
+
+	BasicTransition<ActionT> transition = {event_timestamp, 0, true, PLAYER_RESYNC};
+	transition_output->Push(transition);
+
+	for (unsigned int i = 0; i < MaxActions; ++i)
+	{
+		if (held[i]) transition_output->Push({event_timestamp, (ActionT)i, true, -1});
+	}
+
+	for (unsigned int player = 0; player < SIB_MAX_CONTROLLERS; ++player)
+	{
+		if (controllers[player].id < 0) continue;
+
+		for (unsigned int i = 0; i < MaxActions; ++i)
+		{
+			if (controllers[player].held[i]) transition_output->Push({event_timestamp, (ActionT)i, true, (Sint8)player});
+		}
+	}
+
+	transition.pressed = false;
+	transition_output->Push(transition);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::PressAction(ActionT action, bool repeat)
+{
+	if (!pressed[action] && !released[action]) changed_actions.push_back(action);
+	pressed.set(action);
+
+	if (!repeat && held_count[action]++ == 0)
+	{
+		held.set(action);
+		++press_count[action];
+		AddTransition(action, true, -1);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ReleaseAction(ActionT action, bool was_held)
+{
+	if (!pressed[action] && !released[action]) changed_actions.push_back(action);
+	released.set(action);
+
+	if (was_held && --held_count[action] == 0)
+	{
+		held.reset(action);
+		++release_count[action];
+		AddTransition(action, false, -1);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::PressAction(ActionT action, bool repeat, ControllerState& controller)
+{
+	PressAction(action, repeat);
+	if (!controller.pressed[action] && !controller.released[action]) controller.changed_actions.push_back(action);
+	controller.pressed.set(action);
+
+	if (!repeat && controller.held_count[action]++ == 0)
+	{
+		controller.held.set(action);
+		AddTransition(action, true, (int)(&controller - controllers));
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ReleaseAction(ActionT action, bool was_held, ControllerState& controller)
+{
+	ReleaseAction(action, was_held);
+	if (!controller.pressed[action] && !controller.released[action]) controller.changed_actions.push_back(action);
+	controller.released.set(action);
+
+	if (was_held && --controller.held_count[action] == 0)
+	{
+		controller.held.reset(action);
+		AddTransition(action, false, (int)(&controller - controllers));
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::PressInput(unsigned int input)
+{
+	// A press of an input that is already down is a key repeat, it shouldn't count as holding the
+	// action a second time
+	bool repeat = inputs_held.test(input);
+	inputs_held.set(input);
+
+	if (!repeat && active_bindings->combo_offsets[input] != active_bindings->combo_offsets[input + 1])
+	{
+		PressCombos(input, inputs_held, combo_state, nullptr);
+	}
+
+	Uint32 i = active_bindings->offsets[input];
+	Uint32 end = active_bindings->offsets[input + 1];
+
+	if (i == end) return;
+
+	const ActionT* actions = active_bindings->actions.data();
+
+	do
+	{
+		PressAction(actions[i], repeat);
+	}
+	while (++i < end);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ReleaseInput(unsigned int input)
+{
+	bool was_held = inputs_held.test(input);
+	inputs_held.reset(input);
+
+	if (was_held && active_bindings->combo_offsets[input] != active_bindings->combo_offsets[input + 1])
+	{
+		ReleaseCombos(input, combo_state, nullptr);
+	}
+
+	Uint32 i = active_bindings->offsets[input];
+	Uint32 end = active_bindings->offsets[input + 1];
+
+	if (i == end) return;
+
+	const ActionT* actions = active_bindings->actions.data();
+
+	do
+	{
+		ReleaseAction(actions[i], was_held);
+	}
+	while (++i < end);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::PressInput(unsigned int input, ControllerState& controller)
+{
+	bool repeat = controller.inputs_held.test(input);
+	controller.inputs_held.set(input);
+
+	if (!repeat && active_bindings->combo_offsets[input] != active_bindings->combo_offsets[input + 1])
+	{
+		PressCombos(input, controller.inputs_held, controller.combo_state, &controller);
+	}
+
+	Uint32 i = active_bindings->offsets[input];
+	Uint32 end = active_bindings->offsets[input + 1];
+
+	if (i == end) return;
+
+	const ActionT* actions = active_bindings->actions.data();
+
+	do
+	{
+		PressAction(actions[i], repeat, controller);
+	}
+	while (++i < end);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ReleaseInput(unsigned int input, ControllerState& controller)
+{
+	bool was_held = controller.inputs_held.test(input);
+	controller.inputs_held.reset(input);
+
+	if (was_held && active_bindings->combo_offsets[input] != active_bindings->combo_offsets[input + 1])
+	{
+		ReleaseCombos(input, controller.combo_state, &controller);
+	}
+
+	Uint32 i = active_bindings->offsets[input];
+	Uint32 end = active_bindings->offsets[input + 1];
+
+	if (i == end) return;
+
+	const ActionT* actions = active_bindings->actions.data();
+
+	do
+	{
+		ReleaseAction(actions[i], was_held, controller);
+	}
+	while (++i < end);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::BuildComboIndex(Bindings& bindings)
+{
+	// Counting sort of (input, combo) pairs, each input listed once per combo even if several steps
+	// use it
+	std::vector<Uint16>& index = bindings.combo_index;
+	Uint32* offsets = bindings.combo_offsets;
+
+	for (unsigned int i = 0; i <= INPUT_COUNT; ++i)
+	{
+		offsets[i] = 0;
+	}
+
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		for (std::size_t c = 0; c < bindings.combos.size(); ++c)
+		{
+			const Combo& combo = bindings.combos[c];
+			std::bitset<INPUT_COUNT> seen;
+
+			for (unsigned int step = 0; step < combo.step_count; ++step)
+			{
+				for (unsigned int i = 0; i < combo.step_size[step]; ++i)
+				{
+					unsigned int input = combo.inputs[step][i];
+					if (seen.test(input)) continue;
+					seen.set(input);
+
+					if (pass == 0)
+					{
+						++offsets[input + 1];
+					}
+					else
+					{
+						index[offsets[input]++] = (Uint16)c;
+					}
+				}
+			}
+		}
+
+		if (pass == 0)
+		{
+			for (unsigned int i = 0; i < INPUT_COUNT; ++i)
+			{
+				offsets[i + 1] += offsets[i];
+			}
+
+			index.resize(offsets[INPUT_COUNT]);
+		}
+	}
+
+	// The fill pass left each offset at the end of its range, shift them back
+	for (unsigned int i = INPUT_COUNT; i > 0; --i)
+	{
+		offsets[i] = offsets[i - 1];
+	}
+
+	offsets[0] = 0;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::BuildActionIndex(Bindings& bindings)
+{
+	// Counting sort of (action, input) pairs for tables that weren't built by Bind()
+	std::vector<Uint32>& offsets = bindings.action_offsets;
+	offsets.assign(MaxActions + 1, 0);
+	bindings.action_inputs.resize(bindings.actions.size());
+
+	for (ActionT action : bindings.actions)
+	{
+		++offsets[action + 1];
+	}
+
+	for (std::size_t i = 0; i < MaxActions; ++i)
+	{
+		offsets[i + 1] += offsets[i];
+	}
+
+	for (unsigned int input = 0; input < INPUT_COUNT; ++input)
+	{
+		for (Uint32 i = bindings.offsets[input]; i < bindings.offsets[input + 1]; ++i)
+		{
+			bindings.action_inputs[offsets[bindings.actions[i]]++] = (Uint16)input;
+		}
+	}
+
+	for (std::size_t i = MaxActions; i > 0; --i)
+	{
+		offsets[i] = offsets[i - 1];
+	}
+
+	offsets[0] = 0;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ComboStep(Combo& combo)
+{
+	if (combo.step_count == SIB_COMBO_STEPS)
+	{
+		std::stringstream s;
+		s << "Sequences can have at most " << SIB_COMBO_STEPS << " steps";
+		SetError(BAD_COMBO, s.str());
+		return true;
+	}
+
+	combo.step_size[combo.step_count] = 0;
+	++combo.step_count;
+	return false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ComboInput(Combo& combo, unsigned int input)
+{
+	Uint8& size = combo.step_size[combo.step_count - 1];
+
+	if (size == COMBO_STEP_INPUTS)
+	{
+		std::stringstream s;
+		s << "Chords and sequence steps can have at most " << COMBO_STEP_INPUTS << " inputs";
+		SetError(BAD_COMBO, s.str());
+		return true;
+	}
+
+	combo.inputs[combo.step_count - 1][size] = (Uint16)input;
+	++size;
+	return false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::AddCombo(Combo& combo, ActionT action)
+{
+	if (ValidateAction(action)) return;
+	combo.action = action;
+
+	for (unsigned int step = 0; step < combo.step_count; ++step)
+	{
+		if (combo.step_size[step] == 0)
+		{
+			SetError(BAD_COMBO, "Chords and sequence steps need at least one input");
+			return;
+		}
+	}
+
+	if (combo.step_count == 0 || (!combo.chord && combo.step_count < 2))
+	{
+		SetError(BAD_COMBO, "Sequences need at least two steps");
+		return;
+	}
+
+	// Mapping the same combo to the same action again only updates the window
+	for (Combo& other : edit_bindings->combos)
+	{
+		bool same = other.action == action && other.chord == combo.chord && other.step_count == combo.step_count;
+
+		for (unsigned int step = 0; same && step < combo.step_count; ++step)
+		{
+			same = other.step_size[step] == combo.step_size[step] &&
+				std::equal(combo.inputs[step], combo.inputs[step] + combo.step_size[step], other.inputs[step]);
+		}
+
+		if (same)
+		{
+			other.window = combo.window;
+			return;
+		}
+	}
+
+	if (edit_bindings->combos.size() == SIB_MAX_COMBOS)
+	{
+		std::stringstream s;
+		s << "No room for another chord or sequence, all " << SIB_MAX_COMBOS << " are in use";
+		SetError(BAD_COMBO, s.str());
+		return;
+	}
+
+	edit_bindings->combos.push_back(combo);
+	BuildComboIndex(*edit_bindings);
+	if (!merged_bindings.empty()) merged_dirty = true;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ResetCombos(bool release)
+{
+	for (std::size_t c = 0; c < active_bindings->combos.size(); ++c)
+	{
+		ActionT action = active_bindings->combos[c].action;
+		if (release && combo_state[c].active) ReleaseAction(action, true);
+		combo_state[c] = ComboState();
+
+		for (ControllerState& controller : controllers)
+		{
+			if (release && controller.combo_state[c].active) ReleaseAction(action, true, controller);
+			controller.combo_state[c] = ComboState();
+		}
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ComboStepHeld(const Combo& combo, unsigned int step,
+	unsigned int input, const std::bitset<INPUT_COUNT>& held_inputs)
+{
+	const Uint16* inputs = combo.inputs[step];
+	unsigned int size = combo.step_size[step];
+	bool found = false;
+
+	for (unsigned int i = 0; i < size; ++i)
+	{
+		if (!held_inputs.test(inputs[i])) return false;
+		found |= inputs[i] == input;
+	}
+
+	return found;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::PressCombos(unsigned int input,
+	const std::bitset<INPUT_COUNT>& held_inputs, ComboState* state, ControllerState* controller)
+{
+	Uint32 end = active_bindings->combo_offsets[input + 1];
+
+	for (Uint32 i = active_bindings->combo_offsets[input]; i < end; ++i)
+	{
+		unsigned int c = active_bindings->combo_index[i];
+		const Combo& combo = active_bindings->combos[c];
+		ComboState& s = state[c];
+
+		if (combo.chord)
+		{
+			if (s.active || !ComboStepHeld(combo, 0, input, held_inputs)) continue;
+			s.active = true;
+
+			if (controller)
+			{
+				PressAction(combo.action, false, *controller);
+			}
+			else
+			{
+				PressAction(combo.action, false);
+			}
+
+			continue;
+		}
+
+		// A sequence starts over when it runs out of time or a press doesn't complete the next step,
+		// and that press may start it again
+		if (s.step > 0 && event_timestamp - s.start > combo.window) s.step = 0;
+		if (s.step > 0 && !ComboStepHeld(combo, s.step, input, held_inputs)) s.step = 0;
+
+		if (s.step == 0)
+		{
+			if (!ComboStepHeld(combo, 0, input, held_inputs)) continue;
+			s.start = event_timestamp;
+		}
+
+		if (++s.step < combo.step_count) continue;
+		s.step = 0;
+
+		// Completed sequences are a press and release in the same frame, like the mouse wheel
+		if (controller)
+		{
+			PressAction(combo.action, false, *controller);
+			ReleaseAction(combo.action, true, *controller);
+		}
+		else
+		{
+			PressAction(combo.action, false);
+			ReleaseAction(combo.action, true);
+		}
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ReleaseCombos(unsigned int input, ComboState* state, ControllerState* controller)
+{
+	Uint32 end = active_bindings->combo_offsets[input + 1];
+
+	for (Uint32 i = active_bindings->combo_offsets[input]; i < end; ++i)
+	{
+		unsigned int c = active_bindings->combo_index[i];
+		const Combo& combo = active_bindings->combos[c];
+		ComboState& s = state[c];
+
+		if (!s.active) continue;
+		s.active = false;
+
+		if (controller)
+		{
+			ReleaseAction(combo.action, true, *controller);
+		}
+		else
+		{
+			ReleaseAction(combo.action, true);
+		}
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+int Sib::BasicBinder<MaxActions, ActionT>::ControllerSlot(SDL_JoystickID id)
+{
+	constexpr unsigned int mask = CONTROLLER_TABLE_SIZE - 1;
+
+	for (unsigned int i = id & mask; ; i = (i + 1) & mask)
+	{
+		int slot = controller_table[i];
+		if (slot < 0) return -1;
+		if (controllers[slot].id == id) return slot;
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+int Sib::BasicBinder<MaxActions, ActionT>::AddController(SDL_JoystickID id)
+{
+	int slot = ControllerSlot(id);
+	if (slot >= 0) return slot;
+
+	for (slot = 0; slot < SIB_MAX_CONTROLLERS; ++slot)
+	{
+		if (controllers[slot].id < 0) break;
+	}
+
+	if (slot == SIB_MAX_CONTROLLERS)
+	{
+		SetError(NO_CONTROLLER_SLOT, id, SIB_MAX_CONTROLLERS);
+		return -1;
+	}
+
+	controllers[slot] = ControllerState();
+	controllers[slot].id = id;
+
+	constexpr unsigned int mask = CONTROLLER_TABLE_SIZE - 1;
+	unsigned int i = id & mask;
+
+	while (controller_table[i] >= 0)
+	{
+		i = (i + 1) & mask;
+	}
+
+	controller_table[i] = slot;
+	return slot;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::RemoveController(SDL_JoystickID id)
+{
+	int slot = ControllerSlot(id);
+	if (slot < 0) return;
+
+	ControllerState& controller = controllers[slot];
+
+	// Release whatever the controller was holding down
+	for (unsigned int input = INPUT_CBUTTON; input < INPUT_MBUTTON; ++input)
+	{
+		if (controller.inputs_held.test(input)) ReleaseInput(input, controller);
+	}
+
+	controller.id = -1;
+
+	for (unsigned int axis = 0; axis < SDL_CONTROLLER_AXIS_MAX; ++axis)
+	{
+		controller.axis_value[axis] = 0;
+	}
+
+	// Rebuild the table instead of deleting in place, removals are rare and the table is tiny
+	constexpr unsigned int mask = CONTROLLER_TABLE_SIZE - 1;
+
+	for (unsigned int i = 0; i < CONTROLLER_TABLE_SIZE; ++i)
+	{
+		controller_table[i] = -1;
+	}
+
+	for (int other = 0; other < SIB_MAX_CONTROLLERS; ++other)
+	{
+		if (controllers[other].id < 0) continue;
+
+		unsigned int i = controllers[other].id & mask;
+
+		while (controller_table[i] >= 0)
+		{
+			i = (i + 1) & mask;
+		}
+
+		controller_table[i] = other;
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::HandleKey(const SDL_KeyboardEvent& event)
+{
+	if ((unsigned int)event.keysym.scancode >= SDL_NUM_SCANCODES) return;
+
+	unsigned int input = INPUT_SCANCODE + event.keysym.scancode;
+
+	if (event.state == SDL_PRESSED)
+	{
+		PressInput(input);
+	}
+	else
+	{
+		ReleaseInput(input);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::HandleGamepadButton(const SDL_ControllerButtonEvent& event)
+{
+	if (event.button >= SDL_CONTROLLER_BUTTON_MAX) return;
+
+	int slot = ControllerSlot(event.which);
+	if (slot < 0) slot = AddController(event.which);
+	if (slot < 0) return;
+
+	unsigned int input = INPUT_CBUTTON + event.button;
+
+	if (event.state == SDL_PRESSED)
+	{
+		PressInput(input, controllers[slot]);
+	}
+	else
+	{
+		ReleaseInput(input, controllers[slot]);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UpdateAxis(unsigned int axis, int magnitude, ControllerState& controller)
+{
+	const AxisConfig& config = axis_config[axis];
+	unsigned int input = INPUT_CAXIS + axis;
+
+	if (controller.inputs_held.test(input))
+	{
+		if (magnitude < config.raw_low || magnitude == 0) ReleaseInput(input, controller);
+	}
+	else if (magnitude > config.raw_high)
+	{
+		PressInput(input, controller);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::HandleGamepadAxis(const SDL_ControllerAxisEvent& event)
+{
+	if (event.axis >= SDL_CONTROLLER_AXIS_MAX) return;
+
+	int slot = ControllerSlot(event.which);
+	if (slot < 0) slot = AddController(event.which);
+	if (slot < 0) return;
+
+	ControllerState& controller = controllers[slot];
+	int value = event.value;
+	controller.axis_value[event.axis] = value;
+
+	// Triggers come after the four stick axes in both SDL and Sib::Axis
+	if (event.axis >= SDL_CONTROLLER_AXIS_TRIGGERLEFT)
+	{
+		UpdateAxis(event.axis + 4, value, controller);
+		return;
+	}
+
+	// Sib::Axis lists each stick axis as a positive/negative pair. The negative side is shifted by
+	// one so both sides go from 0 to 32767.
+	UpdateAxis(event.axis * 2, value > 0 ? value : 0, controller);
+	UpdateAxis(event.axis * 2 + 1, value < 0 ? -(value + 1) : 0, controller);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::HandleMouseButton(const SDL_MouseButtonEvent& event)
+{
+	unsigned int index = event.button - 1;
+
+	if (index >= 5) return;
+
+	if (event.state == SDL_PRESSED)
+	{
+		PressInput(INPUT_MBUTTON + index);
+	}
+	else
+	{
+		ReleaseInput(INPUT_MBUTTON + index);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::HandleMouseWheel(const SDL_MouseWheelEvent& event)
+{
+	unsigned int i;
+
+	if (event.x)
+	{
+		if (event.direction == SDL_MOUSEWHEEL_NORMAL)
+		{
+			i = ( event.x > 0 ? 1 : 0 );
+		}
+		else
+		{
+			i = ( event.x > 0 ? 0 : 1 );
+		}
+
+		PressInput(INPUT_WHEEL + i);
+		ReleaseInput(INPUT_WHEEL + i);
+	}
+
+	if (event.y)
+	{
+		if (event.direction == SDL_MOUSEWHEEL_NORMAL)
+		{
+			i = ( event.y > 0 ? 3 : 2 );
+		}
+		else
+		{
+			i = ( event.y > 0 ? 2 : 3 );
+		}
+
+		PressInput(INPUT_WHEEL + i);
+		ReleaseInput(INPUT_WHEEL + i);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::RebindHeldInput(unsigned int input, ActionT action, bool press)
+{
+	// A held input releases the actions bound when it goes up, so an edit to the live table has to
+	// press or release the action now to keep the held counts balanced
+	if (edit_bindings != active_bindings) return;
+
+	if (inputs_held.test(input))
+	{
+		if (press) PressAction(action, false);
+		else ReleaseAction(action, true);
+	}
+
+	for (ControllerState& controller : controllers)
+	{
+		if (controller.id < 0 || !controller.inputs_held.test(input)) continue;
+
+		if (press) PressAction(action, false, controller);
+		else ReleaseAction(action, true, controller);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::Bind(unsigned int input, ActionT action)
+{
+	Uint32 begin = edit_bindings->offsets[input];
+	Uint32 end = edit_bindings->offsets[input + 1];
+
+	for (Uint32 i = begin; i < end; ++i)
+	{
+		if (edit_bindings->actions[i] == action) return;
+	}
+
+	edit_bindings->actions.insert(edit_bindings->actions.begin() + end, action);
+
+	for (unsigned int i = input + 1; i <= INPUT_COUNT; ++i)
+	{
+		++edit_bindings->offsets[i];
+	}
+
+	std::vector<Uint32>& action_offsets = edit_bindings->action_offsets;
+	if (action_offsets.empty()) action_offsets.resize(MaxActions + 1);
+	// Inputs of an action are kept sorted, the same order BuildActionIndex() gives them
+	std::vector<Uint16>& action_inputs = edit_bindings->action_inputs;
+	auto last = action_inputs.begin() + action_offsets[action + 1];
+	action_inputs.insert(std::upper_bound(action_inputs.begin() + action_offsets[action], last, (Uint16)input), (Uint16)input);
+
+	for (std::size_t i = action + 1; i <= MaxActions; ++i)
+	{
+		++action_offsets[i];
+	}
+
+	RebindHeldInput(input, action, true);
+	if (!merged_bindings.empty()) merged_dirty = true;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::Unbind(unsigned int input)
+{
+	Uint32 begin = edit_bindings->offsets[input];
+	Uint32 count = edit_bindings->offsets[input + 1] - begin;
+
+	if (count == 0) return;
+
+	std::vector<Uint32>& action_offsets = edit_bindings->action_offsets;
+	std::vector<Uint16>& action_inputs = edit_bindings->action_inputs;
+
+	for (Uint32 i = begin; i < begin + count; ++i)
+	{
+		ActionT action = edit_bindings->actions[i];
+		RebindHeldInput(input, action, false);
+		auto first = action_inputs.begin() + action_offsets[action];
+		action_inputs.erase(std::find(first, action_inputs.begin() + action_offsets[action + 1], (Uint16)input));
+
+		for (std::size_t j = action + 1; j <= MaxActions; ++j)
+		{
+			--action_offsets[j];
+		}
+	}
+
+	edit_bindings->actions.erase(edit_bindings->actions.begin() + begin, edit_bindings->actions.begin() + begin + count);
+
+	for (unsigned int i = input + 1; i <= INPUT_COUNT; ++i)
+	{
+		edit_bindings->offsets[i] -= count;
+	}
+
+	if (!merged_bindings.empty()) merged_dirty = true;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::Unbind(unsigned int input, ActionT action)
+{
+	Uint32 begin = edit_bindings->offsets[input];
+	Uint32 end = edit_bindings->offsets[input + 1];
+	auto it = std::find(edit_bindings->actions.begin() + begin, edit_bindings->actions.begin() + end, action);
+
+	if (it == edit_bindings->actions.begin() + end) return;
+
+	RebindHeldInput(input, action, false);
+	edit_bindings->actions.erase(it);
+
+	for (unsigned int i = input + 1; i <= INPUT_COUNT; ++i)
+	{
+		--edit_bindings->offsets[i];
+	}
+
+	std::vector<Uint32>& action_offsets = edit_bindings->action_offsets;
+	std::vector<Uint16>& action_inputs = edit_bindings->action_inputs;
+	auto first = action_inputs.begin() + action_offsets[action];
+	action_inputs.erase(std::find(first, action_inputs.begin() + action_offsets[action + 1], (Uint16)input));
+
+	for (std::size_t i = action + 1; i <= MaxActions; ++i)
+	{
+		--action_offsets[i];
+	}
+
+	if (!merged_bindings.empty()) merged_dirty = true;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::BindKeycode(BasicKeycodeBind<ActionT>& bind)
+{
+	unsigned int input = INPUT_SCANCODE + bind.scancode;
+	auto begin = edit_bindings->actions.begin() + edit_bindings->offsets[input];
+	auto end = edit_bindings->actions.begin() + edit_bindings->offsets[input + 1];
+
+	bind.owner = std::find(begin, end, bind.action) == end;
+	if (bind.owner) Bind(input, bind.action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UnbindKeycode(BasicKeycodeBind<ActionT>& bind)
+{
+	if (!bind.owner) return;
+	bind.owner = false;
+
+	// Another keycode on the same key still needs the entry
+	for (BasicKeycodeBind<ActionT>& other : edit_bindings->keycodes)
+	{
+		if (&other != &bind && other.scancode == bind.scancode && other.action == bind.action)
+		{
+			other.owner = true;
+			return;
+		}
+	}
+
+	Unbind(INPUT_SCANCODE + bind.scancode, bind.action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ResolveKeycodes()
+{
+	Bindings* edit = edit_bindings;
+
+	for (std::size_t context = 0; context <= contexts.size(); ++context)
+	{
+		edit_bindings = &ContextBindings((int)context);
+
+		for (BasicKeycodeBind<ActionT>& bind : edit_bindings->keycodes)
+		{
+			SDL_Scancode scancode = SDL_GetScancodeFromKey(bind.keycode);
+			if (scancode == bind.scancode) continue;
+
+			UnbindKeycode(bind);
+			bind.scancode = scancode;
+			if (scancode != SDL_SCANCODE_UNKNOWN) BindKeycode(bind);
+		}
+	}
+
+	edit_bindings = edit;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ValidateInput(unsigned int input)
+{
+	if (input >= INPUT_COUNT)
+	{
+		SetError(BAD_INPUT, input, INPUT_COUNT - 1);
+		return true;
+	}
+
+	return false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ValidateScancode(SDL_Scancode scancode)
+{
+	if (scancode < 0 || scancode >= SDL_NUM_SCANCODES)
+	{
+		SetError(BAD_SCANCODE, scancode, SDL_NUM_SCANCODES - 1);
+		return true;
+	}
+
+	return false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ValidateGamepadButton(Uint8 button)
+{
+	if (button >= SDL_CONTROLLER_BUTTON_MAX)
+	{
+		SetError(BAD_CBUTTON, button, SDL_CONTROLLER_BUTTON_MAX - 1);
+		return true;
+	}
+
+	return false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ValidatePlayer(int player)
+{
+	if (player < 0 || player >= SIB_MAX_CONTROLLERS)
+	{
+		SetError(BAD_PLAYER, player, SIB_MAX_CONTROLLERS - 1);
+		return true;
+	}
+
+	return false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ValidateAxis(Sib::Axis axis)
+{
+	if ((unsigned int)axis >= AXIS_COUNT)
+	{
+		SetError(BAD_AXIS, (Sint64)axis, AXIS_COUNT - 1);
+		return true;
+	}
+
+	return false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ValidatePercent(unsigned char value)
+{
+	if (value > 100)
+	{
+		SetError(BAD_PERCENT, value, 100);
+		return true;
+	}
+
+	return false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ValidateAction(ActionT action)
+{
+	// When every value of ActionT is a valid action there is nothing to check
+	if constexpr (MaxActions - 1 < std::numeric_limits<ActionT>::max())
+	{
+		if (action >= MaxActions)
+		{
+			SetError(BAD_ACTION, (Sint64)action, (Sint64)MaxActions - 1);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ErrorCallback(ErrorCallback_t* ptr)
+{
+	error_callback = ptr;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::TransitionOutput(TransitionRing_t* ring)
+{
+	if (ring && ring->Capacity() < RESYNC_SIZE)
+	{
+		SetError(SMALL_RING, ring->Capacity(), RESYNC_SIZE);
+		return;
+	}
+
+	transition_output = ring;
+	transition_resync = false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::AddActionCallback(ActionT action, ActionCallback_t* callback, void* user_data, int player)
+{
+	if (ValidateAction(action)) return;
+	if (player != -1 && ValidatePlayer(player)) return;
+
+	// Callbacks are grouped by action the same way bindings are grouped by input
+	ActionCallback entry = {callback, user_data, player};
+	callbacks.insert(callbacks.begin() + callback_offsets[action + 1], entry);
+
+	for (std::size_t i = action + 1; i <= MaxActions; ++i)
+	{
+		++callback_offsets[i];
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::RemoveActionCallback(ActionT action, ActionCallback_t* callback, void* user_data)
+{
+	if (ValidateAction(action)) return;
+
+	Uint32 i = callback_offsets[action];
+
+	while (i < callback_offsets[action + 1])
+	{
+		if (callbacks[i].callback != callback || callbacks[i].user_data != user_data)
+		{
+			++i;
+			continue;
+		}
+
+		callbacks.erase(callbacks.begin() + i);
+
+		for (std::size_t j = action + 1; j <= MaxActions; ++j)
+		{
+			--callback_offsets[j];
+		}
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+const char* Sib::BasicBinder<MaxActions, ActionT>::ErrorStr()
+{
+	if (!error_is_record) return error_str.c_str();
+
+	if (error_text_stale)
+	{
+		ErrorText(error_ring[(error_total - 1) % SIB_ERROR_RING], error_text, sizeof(error_text));
+		error_text_stale = false;
+	}
+
+	return error_text;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+Sib::Error_t Sib::BasicBinder<MaxActions, ActionT>::Error()
+{
+	return error;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+unsigned int Sib::BasicBinder<MaxActions, ActionT>::ErrorCount()
+{
+	return error_total < SIB_ERROR_RING ? error_total : SIB_ERROR_RING;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+const Sib::ErrorRecord& Sib::BasicBinder<MaxActions, ActionT>::ErrorAt(unsigned int i)
+{
+	static const ErrorRecord none = {NO_ERROR, 0, 0};
+	if (i >= ErrorCount()) return none;
+	return error_ring[(error_total - ErrorCount() + i) % SIB_ERROR_RING];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ClearErrors()
+{
+	// Error() and ErrorStr() go back to no error too, a record left marked as the last error would
+	// format a slot that is no longer there
+	error_total = 0;
+	error = NO_ERROR;
+	error_str.clear();
+	error_is_record = false;
+	error_text_stale = false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MapScancode(SDL_Scancode scancode, ActionT action)
+{
+	if (ValidateAction(action)) return;
+	if (ValidateScancode(scancode)) return;
+
+	// An explicit bind takes over an entry a keycode bind added, so unmapping the keycode keeps it
+	for (BasicKeycodeBind<ActionT>& bind : edit_bindings->keycodes)
+	{
+		if (bind.owner && bind.scancode == scancode && bind.action == action)
+		{
+			bind.owner = false;
+			return;
+		}
+	}
+
+	Bind(INPUT_SCANCODE + scancode, action);
+}
+	
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UnmapScancode(SDL_Scancode scancode)
+{
+	if (ValidateScancode(scancode)) return;
+	unsigned int input = INPUT_SCANCODE + scancode;
+
+	// Actions that keycode binds put on the key stay, only the explicit binds go
+	for (Uint32 i = edit_bindings->offsets[input + 1]; i-- > edit_bindings->offsets[input];)
+	{
+		ActionT action = edit_bindings->actions[i];
+		BasicKeycodeBind<ActionT>* keycode = nullptr;
+		bool owned = false;
+
+		for (BasicKeycodeBind<ActionT>& bind : edit_bindings->keycodes)
+		{
+			if (bind.scancode != scancode || bind.action != action) continue;
+			if (!keycode) keycode = &bind;
+			owned = owned || bind.owner;
+		}
+
+		if (!keycode) Unbind(input, action);
+		else if (!owned) keycode->owner = true;
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MapKeycode(SDL_Keycode keycode, ActionT action)
+{
+	if (ValidateAction(action)) return;
+
+	for (const BasicKeycodeBind<ActionT>& bind : edit_bindings->keycodes)
+	{
+		if (bind.keycode == keycode && bind.action == action) return;
+	}
+
+	// A Watcher's parser leaves the lookup to SwapStagedBindings()
+	SDL_Scancode scancode = staging ? SDL_SCANCODE_UNKNOWN : SDL_GetScancodeFromKey(keycode);
+	edit_bindings->keycodes.push_back({keycode, scancode, action, false});
+	if (staging) return;
+
+	if (scancode == SDL_SCANCODE_UNKNOWN)
+	{
+		std::stringstream s;
+		s << "Keycode " << SDL_GetKeyName(keycode) << " has no matching scancode in the current layout";
+		SetError(NO_SCANCODE, s.str());
+		return;
+	}
+
+	BindKeycode(edit_bindings->keycodes.back());
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UnmapKeycode(SDL_Keycode keycode)
+{
+	std::vector<BasicKeycodeBind<ActionT>>& keycodes = edit_bindings->keycodes;
+
+	for (BasicKeycodeBind<ActionT>& bind : keycodes)
+	{
+		if (bind.keycode == keycode) UnbindKeycode(bind);
+	}
+
+	keycodes.erase(std::remove_if(keycodes.begin(), keycodes.end(),
+		[keycode](const BasicKeycodeBind<ActionT>& bind) { return bind.keycode == keycode; }), keycodes.end());
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MapGamepadButton(Uint8 button, ActionT action)
+{
+	if (ValidateAction(action)) return;
+	if (ValidateGamepadButton(button)) return;
+	Bind(INPUT_CBUTTON + button, action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UnmapGamepadButton(Uint8 button)
+{
+	if (ValidateGamepadButton(button)) return;
+	Unbind(INPUT_CBUTTON + button);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MapGamepadAxis(Sib::Axis axis, ActionT action)
+{
+	if (ValidateAction(action)) return;
+	if (ValidateAxis(axis)) return;
+	Bind(INPUT_CAXIS + (unsigned int)axis, action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UnmapGamepadAxis(Sib::Axis axis)
+{
+	if (ValidateAxis(axis)) return;
+	Unbind(INPUT_CAXIS + (unsigned int)axis);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MapMouseButton(Uint8 button, ActionT action)
+{
+	if (ValidateAction(action)) return;
+
+	if (button < 1 || button > 5)
+	{
+		SetError(BAD_MB, button, 5);
+		return;
+	}
+
+	Bind(INPUT_MBUTTON + button - 1, action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UnmapMouseButton(Uint8 button)
+{
+	if (button < 1 || button > 5)
+	{
+		SetError(BAD_MB, button, 5);
+		return;
+	}
+
+	Unbind(INPUT_MBUTTON + button - 1);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MapMouseWheelUp(ActionT action)
+{
+	if (ValidateAction(action)) return;
+	Bind(INPUT_WHEEL + 3, action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UnmapMouseWheelUp()
+{
+	Unbind(INPUT_WHEEL + 3);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MapMouseWheelDown(ActionT action)
+{
+	if (ValidateAction(action)) return;
+	Bind(INPUT_WHEEL + 2, action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UnmapMouseWheelDown()
+{
+	Unbind(INPUT_WHEEL + 2);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MapMouseWheelLeft(ActionT action)
+{
+	if (ValidateAction(action)) return;
+	Bind(INPUT_WHEEL + 0, action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UnmapMouseWheelLeft()
+{
+	Unbind(INPUT_WHEEL + 0);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MapMouseWheelRight(ActionT action)
+{
+	if (ValidateAction(action)) return;
+	Bind(INPUT_WHEEL + 1, action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UnmapMouseWheelRight()
+{
+	Unbind(INPUT_WHEEL + 1);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UpdateAxisConfig(AxisConfig& config)
+{
+	// Matches the old value / 327 comparisons, pressed above (high + 1) * 327 - 1 and released
+	// below low * 327
+	int high = (config.threshold_high + 1) * 327 - 1;
+	config.raw_low = config.threshold_low * 327;
+	config.raw_high = high > 32767 ? 32767 : high;
+	config.raw_deadzone = config.deadzone * 32767 / 100;
+	config.scale = config.raw_deadzone < 32767 ? 1.0f / (32767 - config.raw_deadzone) : 0.0f;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MapScancodeChord(std::initializer_list<SDL_Scancode> scancodes, ActionT action)
+{
+	Combo combo = {};
+	combo.chord = true;
+	ComboStep(combo);
+
+	for (SDL_Scancode scancode : scancodes)
+	{
+		if (ValidateScancode(scancode) || ComboInput(combo, INPUT_SCANCODE + scancode)) return;
+	}
+
+	AddCombo(combo, action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MapGamepadButtonChord(std::initializer_list<Uint8> buttons, ActionT action)
+{
+	Combo combo = {};
+	combo.chord = true;
+	ComboStep(combo);
+
+	for (Uint8 button : buttons)
+	{
+		if (ValidateGamepadButton(button) || ComboInput(combo, INPUT_CBUTTON + button)) return;
+	}
+
+	AddCombo(combo, action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MapScancodeSequence(
+	std::initializer_list<std::initializer_list<SDL_Scancode>> steps, Uint32 window, ActionT action)
+{
+	Combo combo = {};
+	combo.window = window;
+
+	for (const std::initializer_list<SDL_Scancode>& step : steps)
+	{
+		if (ComboStep(combo)) return;
+
+		for (SDL_Scancode scancode : step)
+		{
+			if (ValidateScancode(scancode) || ComboInput(combo, INPUT_SCANCODE + scancode)) return;
+		}
+	}
+
+	AddCombo(combo, action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MapGamepadButtonSequence(
+	std::initializer_list<std::initializer_list<Uint8>> steps, Uint32 window, ActionT action)
+{
+	Combo combo = {};
+	combo.window = window;
+
+	for (const std::initializer_list<Uint8>& step : steps)
+	{
+		if (ComboStep(combo)) return;
+
+		for (Uint8 button : step)
+		{
+			if (ValidateGamepadButton(button) || ComboInput(combo, INPUT_CBUTTON + button)) return;
+		}
+	}
+
+	AddCombo(combo, action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UnmapCombos(ActionT action)
+{
+	if (ValidateAction(action)) return;
+
+	// Removing combos moves the others to new slots, so every combo state starts over. An edit to
+	// another table reaches the active one through UpdateContexts(), which resets them then.
+	if (edit_bindings == active_bindings) ResetCombos(true);
+
+	std::vector<Combo>& combos = edit_bindings->combos;
+	combos.erase(std::remove_if(combos.begin(), combos.end(), [action](const Combo& combo) { return combo.action == action; }), combos.end());
+
+	if (staging)
+	{
+		std::vector<DeferredCombo>& deferred = staging->combos;
+		deferred.erase(std::remove_if(deferred.begin(), deferred.end(),
+			[action](const DeferredCombo& combo) { return combo.combo.action == action; }), deferred.end());
+	}
+	BuildComboIndex(*edit_bindings);
+	if (!merged_bindings.empty()) merged_dirty = true;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ValidateContext(int context)
+{
+	if (context < 0 || context > (int)contexts.size())
+	{
+		std::stringstream s;
+		s << "Context " << context << " not in range 0-" << contexts.size();
+		SetError(BAD_CONTEXT, s.str());
+		return true;
+	}
+
+	return false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+typename Sib::BasicBinder<MaxActions, ActionT>::Bindings& Sib::BasicBinder<MaxActions, ActionT>::ContextBindings(int context)
+{
+	return context == 0 ? bindings : contexts[context - 1]->bindings;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::MergeContexts(Uint32 mask, Bindings& merged)
+{
+	// Highest priority first, later contexts first among equals, the default context always last
+	int order[SIB_MAX_CONTEXTS + 1];
+	unsigned int count = 0;
+
+	for (int context = (int)contexts.size(); context > 0; --context)
+	{
+		if (!(mask & (1u << context))) continue;
+
+		unsigned int i = count++;
+
+		while (i > 0 && contexts[order[i - 1] - 1]->priority < contexts[context - 1]->priority)
+		{
+			order[i] = order[i - 1];
+			--i;
+		}
+
+		order[i] = context;
+	}
+
+	order[count++] = 0;
+
+	merged.actions.clear();
+	merged.offsets[0] = 0;
+
+	for (unsigned int input = 0; input < INPUT_COUNT; ++input)
+	{
+		Uint32 begin = (Uint32)merged.actions.size();
+
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			const Bindings& source = ContextBindings(order[i]);
+			Uint32 end = source.offsets[input + 1];
+
+			for (Uint32 j = source.offsets[input]; j < end; ++j)
+			{
+				ActionT action = source.actions[j];
+
+				if (std::find(merged.actions.begin() + begin, merged.actions.end(), action) == merged.actions.end())
+				{
+					merged.actions.push_back(action);
+				}
+			}
+
+			if (order[i] != 0 && contexts[order[i] - 1]->consume && source.offsets[input] != end) break;
+		}
+
+		merged.offsets[input + 1] = (Uint32)merged.actions.size();
+	}
+
+	merged.combos.clear();
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		for (const Combo& combo : ContextBindings(order[i]).combos)
+		{
+			if (merged.combos.size() == SIB_MAX_COMBOS)
+			{
+				std::stringstream s;
+				s << "Active contexts have more than " << SIB_MAX_COMBOS << " chords and sequences, some are left out";
+				SetError(BAD_COMBO, s.str());
+				break;
+			}
+
+			merged.combos.push_back(combo);
+		}
+	}
+
+	BuildComboIndex(merged);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ReleaseChangedInputs(const Bindings& next)
+{
+	if (&next == active_bindings) return;
+
+	// Combo slots differ between tables, so every combo starts over
+	ResetCombos(true);
+
+	// Release inputs whose actions change, the rest stay held. A released input is forgotten, so its
+	// release event later doesn't release anything in the new table.
+	const Bindings& current = *active_bindings;
+
+	auto changed = [&current, &next](unsigned int input)
+	{
+		return !std::equal(current.actions.begin() + current.offsets[input], current.actions.begin() + current.offsets[input + 1],
+			next.actions.begin() + next.offsets[input], next.actions.begin() + next.offsets[input + 1]);
+	};
+
+	for (unsigned int input = 0; input < INPUT_COUNT; ++input)
+	{
+		if (inputs_held.test(input) && changed(input)) ReleaseInput(input);
+	}
+
+	for (ControllerState& controller : controllers)
+	{
+		if (controller.id < 0) continue;
+
+		for (unsigned int input = INPUT_CBUTTON; input < INPUT_MBUTTON; ++input)
+		{
+			if (controller.inputs_held.test(input) && changed(input)) ReleaseInput(input, controller);
+		}
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::UpdateContexts()
+{
+	// Merged tables are cached by the set of active contexts, so switching back to a set that was
+	// used before is a lookup
+	Bindings* next = &bindings;
+	std::unique_ptr<Bindings> fresh;
+
+	if (context_mask && merged_dirty)
+	{
+		// The cached tables are stale, but the active one is needed until held inputs are released
+		fresh = std::make_unique<Bindings>();
+		MergeContexts(context_mask, *fresh);
+		next = fresh.get();
+	}
+	else if (context_mask)
+	{
+		auto result = merged_bindings.try_emplace(context_mask);
+		if (result.second) MergeContexts(context_mask, result.first->second);
+		next = &result.first->second;
+	}
+
+	ReleaseChangedInputs(*next);
+
+	if (merged_dirty) merged_bindings.clear();
+	merged_dirty = false;
+
+	if (fresh) next = &(merged_bindings[context_mask] = std::move(*fresh));
+	active_bindings = next;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+int Sib::BasicBinder<MaxActions, ActionT>::AddContext(const std::string& name, int priority, bool consume)
+{
+	if (FindContext(name) >= 0)
+	{
+		std::stringstream s;
+		s << "There is already a context named \"" << name << "\"";
+		SetError(BAD_CONTEXT, s.str());
+		return -1;
+	}
+
+	if (contexts.size() == SIB_MAX_CONTEXTS)
+	{
+		std::stringstream s;
+		s << "No room for context \"" << name << "\", all " << SIB_MAX_CONTEXTS << " are in use";
+		SetError(BAD_CONTEXT, s.str());
+		return -1;
+	}
+
+	contexts.push_back(std::make_unique<Context>());
+	contexts.back()->name = name;
+	contexts.back()->priority = priority;
+	contexts.back()->consume = consume;
+	return (int)contexts.size();
+}
+
+template<std::size_t MaxActions, typename ActionT>
+int Sib::BasicBinder<MaxActions, ActionT>::FindContext(std::string_view name)
+{
+	if (name == "default") return 0;
+
+	for (std::size_t i = 0; i < contexts.size(); ++i)
+	{
+		if (contexts[i]->name == name) return (int)i + 1;
+	}
+
+	return -1;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::EditContext(int context)
+{
+	if (ValidateContext(context)) return;
+	edit_bindings = &ContextBindings(context);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::PushContext(int context)
+{
+	if (ValidateContext(context)) return;
+
+	if (context == 0 || (context_mask & (1u << context)))
+	{
+		std::stringstream s;
+		s << "Context " << context << " is already active";
+		SetError(BAD_CONTEXT, s.str());
+		return;
+	}
+
+	context_stack.push_back(context);
+	context_mask |= 1u << context;
+	UpdateContexts();
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::PopContext()
+{
+	if (context_stack.empty())
+	{
+		SetError(BAD_CONTEXT, "No context to pop");
+		return;
+	}
+
+	context_mask &= ~(1u << context_stack.back());
+	context_stack.pop_back();
+	UpdateContexts();
+}
+
+template<std::size_t MaxActions, typename ActionT>
+const ActionT* Sib::BasicBinder<MaxActions, ActionT>::InputActions(unsigned int input, unsigned int& count)
+{
+	count = 0;
+	if (ValidateInput(input)) return nullptr;
+
+	count = edit_bindings->offsets[input + 1] - edit_bindings->offsets[input];
+	return edit_bindings->actions.data() + edit_bindings->offsets[input];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+const Uint16* Sib::BasicBinder<MaxActions, ActionT>::ActionInputs(ActionT action, unsigned int& count)
+{
+	count = 0;
+	if (ValidateAction(action) || edit_bindings->action_offsets.empty()) return nullptr;
+
+	count = edit_bindings->action_offsets[action + 1] - edit_bindings->action_offsets[action];
+	return edit_bindings->action_inputs.data() + edit_bindings->action_offsets[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ContextActive(int context)
+{
+	if (ValidateContext(context)) return false;
+	return context == 0 || (context_mask & (1u << context));
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::AxisThresholdLow(unsigned char value)
+{
+	if (value > 100) value = 100;
+	axis_threshold_low = value;
+
+	for (unsigned int axis = 0; axis < AXIS_COUNT; ++axis)
+	{
+		axis_config[axis].threshold_low = value;
+		UpdateAxisConfig(axis_config[axis]);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+unsigned char Sib::BasicBinder<MaxActions, ActionT>::AxisThresholdLow()
+{
+	return axis_threshold_low;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::AxisThresholdHigh(unsigned char value)
+{
+	if (value > 100) value = 100;
+	axis_threshold_high = value;
+
+	for (unsigned int axis = 0; axis < AXIS_COUNT; ++axis)
+	{
+		axis_config[axis].threshold_high = value;
+		UpdateAxisConfig(axis_config[axis]);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+unsigned char Sib::BasicBinder<MaxActions, ActionT>::AxisThresholdHigh()
+{
+	return axis_threshold_high;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::AxisThresholdLow(Sib::Axis axis, unsigned char value)
+{
+	if (ValidateAxis(axis)) return;
+	if (ValidatePercent(value)) return;
+	AxisConfig& config = axis_config[(unsigned int)axis];
+	config.threshold_low = value;
+	UpdateAxisConfig(config);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+unsigned char Sib::BasicBinder<MaxActions, ActionT>::AxisThresholdLow(Sib::Axis axis)
+{
+	if (ValidateAxis(axis)) return 0;
+	return axis_config[(unsigned int)axis].threshold_low;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::AxisThresholdHigh(Sib::Axis axis, unsigned char value)
+{
+	if (ValidateAxis(axis)) return;
+	if (ValidatePercent(value)) return;
+	AxisConfig& config = axis_config[(unsigned int)axis];
+	config.threshold_high = value;
+	UpdateAxisConfig(config);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+unsigned char Sib::BasicBinder<MaxActions, ActionT>::AxisThresholdHigh(Sib::Axis axis)
+{
+	if (ValidateAxis(axis)) return 0;
+	return axis_config[(unsigned int)axis].threshold_high;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::AxisDeadzone(unsigned char value)
+{
+	if (ValidatePercent(value)) return;
+
+	for (unsigned int axis = 0; axis < AXIS_COUNT; ++axis)
+	{
+		axis_config[axis].deadzone = value;
+		UpdateAxisConfig(axis_config[axis]);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::AxisDeadzone(Sib::Axis axis, unsigned char value)
+{
+	if (ValidateAxis(axis)) return;
+	if (ValidatePercent(value)) return;
+	AxisConfig& config = axis_config[(unsigned int)axis];
+	config.deadzone = value;
+	UpdateAxisConfig(config);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+unsigned char Sib::BasicBinder<MaxActions, ActionT>::AxisDeadzone(Sib::Axis axis)
+{
+	if (ValidateAxis(axis)) return 0;
+	return axis_config[(unsigned int)axis].deadzone;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+float Sib::BasicBinder<MaxActions, ActionT>::AxisValue(unsigned int axis, const ControllerState& controller)
+{
+	int value;
+
+	if (axis >= (unsigned int)Axis::Left_Trigger)
+	{
+		value = controller.axis_value[axis - 4];
+	}
+	else
+	{
+		value = controller.axis_value[axis / 2];
+		if (axis & 1) value = -(value + 1);
+	}
+
+	const AxisConfig& config = axis_config[axis];
+	if (value <= config.raw_deadzone) return 0.0f;
+	return (value - config.raw_deadzone) * config.scale;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+float Sib::BasicBinder<MaxActions, ActionT>::AxisValue(Sib::Axis axis)
+{
+	if (ValidateAxis(axis)) return 0.0f;
+
+	float result = 0.0f;
+
+	for (unsigned int i = 0; i < SIB_MAX_CONTROLLERS; ++i)
+	{
+		if (controllers[i].id == -1) continue;
+		float value = AxisValue((unsigned int)axis, controllers[i]);
+		if (value > result) result = value;
+	}
+
+	return result;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+float Sib::BasicBinder<MaxActions, ActionT>::AxisValue(Sib::Axis axis, int player)
+{
+	if (ValidateAxis(axis)) return 0.0f;
+	if (ValidatePlayer(player)) return 0.0f;
+	if (controllers[player].id == -1) return 0.0f;
+	return AxisValue((unsigned int)axis, controllers[player]);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+float Sib::BasicBinder<MaxActions, ActionT>::Value(ActionT action, const ControllerState& controller, unsigned int& axis_holds)
+{
+	float result = 0.0f;
+	const ActionT* actions = active_bindings->actions.data();
+
+	for (unsigned int axis = 0; axis < AXIS_COUNT; ++axis)
+	{
+		unsigned int input = INPUT_CAXIS + axis;
+
+		for (Uint32 i = active_bindings->offsets[input]; i < active_bindings->offsets[input + 1]; ++i)
+		{
+			if (actions[i] != action) continue;
+
+			float value = AxisValue(axis, controller);
+			if (value > result) result = value;
+			if (controller.inputs_held.test(input)) ++axis_holds;
+		}
+	}
+
+	return result;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+float Sib::BasicBinder<MaxActions, ActionT>::Value(ActionT action)
+{
+	if (ValidateAction(action)) return 0.0f;
+
+	float result = 0.0f;
+	unsigned int axis_holds = 0;
+
+	for (unsigned int i = 0; i < SIB_MAX_CONTROLLERS; ++i)
+	{
+		if (controllers[i].id == -1) continue;
+		float value = Value(action, controllers[i], axis_holds);
+		if (value > result) result = value;
+	}
+
+	// Held by something other than an axis, like a key or button
+	if (held_count[action] > axis_holds) return 1.0f;
+	return result;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+float Sib::BasicBinder<MaxActions, ActionT>::Value(ActionT action, int player)
+{
+	if (ValidateAction(action)) return 0.0f;
+	if (ValidatePlayer(player)) return 0.0f;
+
+	ControllerState& controller = controllers[player];
+	if (controller.id == -1) return 0.0f;
+
+	unsigned int axis_holds = 0;
+	float result = Value(action, controller, axis_holds);
+	if (controller.held_count[action] > axis_holds) return 1.0f;
+	return result;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::Pressed(ActionT action)
+{
+	if (ValidateAction(action)) return false;
+	return pressed[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::Released(ActionT action) 
+{
+	if (ValidateAction(action)) return false;
+	return released[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::Pressed(ActionT action, int player)
+{
+	if (ValidateAction(action)) return false;
+	if (ValidatePlayer(player)) return false;
+	return controllers[player].pressed[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::Released(ActionT action, int player)
+{
+	if (ValidateAction(action)) return false;
+	if (ValidatePlayer(player)) return false;
+	return controllers[player].released[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::Held(ActionT action)
+{
+	if (ValidateAction(action)) return false;
+	return held[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::Held(ActionT action, int player)
+{
+	if (ValidateAction(action)) return false;
+	if (ValidatePlayer(player)) return false;
+	return controllers[player].held[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::AnyPressed(const ActionMask& mask)
+{
+	return (pressed & mask).any();
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::AnyReleased(const ActionMask& mask)
+{
+	return (released & mask).any();
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::AnyHeld(const ActionMask& mask)
+{
+	return (held & mask).any();
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::AllHeld(const ActionMask& mask)
+{
+	return (held & mask) == mask;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+const typename Sib::BasicBinder<MaxActions, ActionT>::ActionMask& Sib::BasicBinder<MaxActions, ActionT>::PressedMask()
+{
+	return pressed;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+const typename Sib::BasicBinder<MaxActions, ActionT>::ActionMask& Sib::BasicBinder<MaxActions, ActionT>::ReleasedMask()
+{
+	return released;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+const typename Sib::BasicBinder<MaxActions, ActionT>::ActionMask& Sib::BasicBinder<MaxActions, ActionT>::HeldMask()
+{
+	return held;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+template<ActionT Action>
+bool Sib::BasicBinder<MaxActions, ActionT>::Pressed()
+{
+	static_assert(Action < MaxActions, "Action out of range");
+	return pressed[Action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+template<ActionT Action>
+bool Sib::BasicBinder<MaxActions, ActionT>::Released()
+{
+	static_assert(Action < MaxActions, "Action out of range");
+	return released[Action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+template<ActionT Action>
+bool Sib::BasicBinder<MaxActions, ActionT>::Held()
+{
+	static_assert(Action < MaxActions, "Action out of range");
+	return held[Action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+unsigned int Sib::BasicBinder<MaxActions, ActionT>::PressCount(ActionT action)
+{
+	if (ValidateAction(action)) return 0;
+	return press_count[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+unsigned int Sib::BasicBinder<MaxActions, ActionT>::ReleaseCount(ActionT action)
+{
+	if (ValidateAction(action)) return 0;
+	return release_count[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+const Sib::BasicTransition<ActionT>* Sib::BasicBinder<MaxActions, ActionT>::Transitions()
+{
+	return transitions.data();
+}
+
+template<std::size_t MaxActions, typename ActionT>
+unsigned int Sib::BasicBinder<MaxActions, ActionT>::TransitionCount()
+{
+	return (unsigned int)transitions.size();
+}
+
+template<std::size_t MaxActions, typename ActionT>
+int Sib::BasicBinder<MaxActions, ActionT>::Player(SDL_JoystickID id)
+{
+	return ControllerSlot(id);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::HandleInput(const SDL_Event& event)
+{
+	event_timestamp = event.common.timestamp;
+	if (merged_dirty) UpdateContexts();
+	if (event_record) RecordEvent(event);
+
+	switch (event.type)
+	{
+	default:
+		break;
+	case SDL_KEYDOWN:
+	case SDL_KEYUP:
+		HandleKey(event.key);
+		break;
+	case SDL_MOUSEBUTTONDOWN:
+	case SDL_MOUSEBUTTONUP:
+		HandleMouseButton(event.button);
+		break;
+	case SDL_MOUSEWHEEL:
+		HandleMouseWheel(event.wheel);
+		break;
+	case SDL_CONTROLLERBUTTONDOWN:
+	case SDL_CONTROLLERBUTTONUP:
+		HandleGamepadButton(event.cbutton);
+		break;
+	case SDL_CONTROLLERAXISMOTION:
+		HandleGamepadAxis(event.caxis);
+		break;
+	case SDL_CONTROLLERDEVICEADDED:
+		AddController(SDL_JoystickGetDeviceInstanceID(event.cdevice.which));
+		break;
+	case SDL_CONTROLLERDEVICEREMOVED:
+		RemoveController(event.cdevice.which);
+		break;
+	case SDL_KEYMAPCHANGED:
+		ResolveKeycodes();
+		if (merged_dirty) UpdateContexts();
+		break;
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::HandleInputs(const SDL_Event* events, unsigned int count)
+{
+	for (unsigned int i = 0; i < count; ++i) HandleInput(events[i]);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+unsigned int Sib::BasicBinder<MaxActions, ActionT>::PollEvents()
+{
+	SDL_PumpEvents();
+	event_count = 0;
+
+	while (true)
+	{
+		if (event_buffer.size() < event_count + SIB_EVENT_CHUNK)
+		{
+			event_buffer.resize(event_count + SIB_EVENT_CHUNK);
+		}
+
+		int n = SDL_PeepEvents(event_buffer.data() + event_count, SIB_EVENT_CHUNK, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+		if (n <= 0) break;
+		event_count += n;
+		if (n < SIB_EVENT_CHUNK) break;
+	}
+
+	HandleInputs(event_buffer.data(), event_count);
+	return event_count;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+const SDL_Event* Sib::BasicBinder<MaxActions, ActionT>::Events()
+{
+	return event_buffer.data();
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::SwapStagedBindings()
+{
+	StagedBindings* staged = staged_bindings.exchange(nullptr, std::memory_order_acquire);
+	if (!staged) return;
+
+	if (staged->error != NO_ERROR)
+	{
+		SetError(staged->error, staged->error_str);
+		delete staged;
+		return;
+	}
+
+	// Held inputs may map to different actions in the new tables, so release them through the tables
+	// that pressed them. Their release events later leave the held counts alone.
+	ResetCombos(true);
+
+	for (unsigned int input = 0; input < INPUT_COUNT; ++input)
+	{
+		if (inputs_held.test(input)) ReleaseInput(input);
+	}
+
+	for (ControllerState& controller : controllers)
+	{
+		if (controller.id < 0) continue;
+
+		for (unsigned int input = INPUT_CBUTTON; input < INPUT_MBUTTON; ++input)
+		{
+			if (controller.inputs_held.test(input)) ReleaseInput(input, controller);
+		}
+	}
+
+	std::swap(bindings, staged->bindings);
+
+	// Keycodes the watcher thread couldn't look up
+	Bindings* edit = edit_bindings;
+	edit_bindings = &bindings;
+
+	for (DeferredCombo& deferred : staged->combos)
+	{
+		bool resolved = true;
+
+		for (unsigned int step = 0; resolved && step < deferred.combo.step_count; ++step)
+		{
+			for (unsigned int i = 0; resolved && i < deferred.combo.step_size[step]; ++i)
+			{
+				SDL_Scancode scancode = SDL_GetScancodeFromKey(deferred.keycodes[step][i]);
+				deferred.combo.inputs[step][i] = (Uint16)(INPUT_SCANCODE + scancode);
+				resolved = scancode != SDL_SCANCODE_UNKNOWN;
+
+				if (!resolved)
+				{
+					std::stringstream s;
+					s << "Line " << deferred.line << ": Keycode " << SDL_GetKeyName(deferred.keycodes[step][i]) << " has no matching scancode";
+					SetError(NO_SCANCODE, s.str());
+				}
+			}
+		}
+
+		if (resolved) AddCombo(deferred.combo, deferred.combo.action);
+	}
+
+	edit_bindings = edit;
+	ResolveKeycodes();
+
+	for (const BasicKeycodeBind<ActionT>& bind : bindings.keycodes)
+	{
+		if (bind.scancode != SDL_SCANCODE_UNKNOWN) continue;
+
+		std::stringstream s;
+		s << "Keycode " << SDL_GetKeyName(bind.keycode) << " has no matching scancode in the current layout";
+		SetError(NO_SCANCODE, s.str());
+	}
+
+	// The default context changed under the merged tables
+	if (!merged_bindings.empty())
+	{
+		merged_dirty = true;
+		UpdateContexts();
+	}
+
+	delete staged;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ResetInputs()                                                         
+{
+	if (event_record) event_record->push_back({event_timestamp, 0, 0, 0, 0});
+
+	// Only the actions touched this frame need clearing, so a frame costs the same no matter how
+	// many actions there are
+	for (ActionT action : changed_actions)
+	{
+		pressed.reset(action);
+		released.reset(action);
+		press_count[action] = 0;
+		release_count[action] = 0;
+	}
+
+	changed_actions.clear();
+	transitions.clear();
+	if (transition_resync && transition_output) SendResync();
+
+	for (ControllerState& controller : controllers)
+	{
+		for (ActionT action : controller.changed_actions)
+		{
+			controller.pressed.reset(action);
+			controller.released.reset(action);
+		}
+
+		controller.changed_actions.clear();
+	}
+
+	if (staged_bindings.load(std::memory_order_relaxed)) SwapStagedBindings();
+}
+
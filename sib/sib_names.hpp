@@ -0,0 +1,123 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "sib.hpp"
+#include <cstring>
+
+template<typename ActionT>
+Uint32 Sib::BasicActionNames<ActionT>::Hash(std::string_view name)
+{
+	// FNV-1a
+	Uint32 hash = 2166136261u;
+
+	for (char c : name)
+	{
+		hash = (hash ^ (unsigned char)c) * 16777619u;
+	}
+
+	return hash;
+}
+
+template<typename ActionT>
+Uint32 Sib::BasicActionNames<ActionT>::Slot(std::string_view name, Uint32 hash)
+{
+	Uint32 mask = (Uint32)slots.size() - 1;
+	Uint32 i = hash & mask;
+
+	while (slots[i])
+	{
+		const Entry& entry = entries[slots[i] - 1];
+
+		if (entry.hash == hash && entry.length == name.size() &&
+			std::memcmp(pool.data() + entry.offset, name.data(), name.size()) == 0)
+		{
+			break;
+		}
+
+		i = (i + 1) & mask;
+	}
+
+	return i;
+}
+
+template<typename ActionT>
+void Sib::BasicActionNames<ActionT>::Grow()
+{
+	slots.assign(slots.empty() ? 16 : slots.size() * 2, 0);
+	Uint32 mask = (Uint32)slots.size() - 1;
+
+	for (Uint32 e = 0; e < entries.size(); ++e)
+	{
+		Uint32 i = entries[e].hash & mask;
+		while (slots[i]) i = (i + 1) & mask;
+		slots[i] = e + 1;
+	}
+}
+
+template<typename ActionT>
+void Sib::BasicActionNames<ActionT>::Set(std::string_view name, ActionT action)
+{
+	// Keep the table at most half full so probes stay short
+	if ((entries.size() + 1) * 2 > slots.size()) Grow();
+
+	Uint32 hash = Hash(name);
+	Uint32 i = Slot(name, hash);
+
+	if (slots[i])
+	{
+		entries[slots[i] - 1].action = action;
+		return;
+	}
+
+	entries.push_back({(Uint32)pool.size(), (Uint32)name.size(), hash, action});
+	pool.append(name);
+	slots[i] = (Uint32)entries.size();
+}
+
+template<typename ActionT>
+bool Sib::BasicActionNames<ActionT>::Find(std::string_view name, ActionT& action)
+{
+	if (slots.empty()) return false;
+
+	Uint32 i = Slot(name, Hash(name));
+	if (!slots[i]) return false;
+
+	action = entries[slots[i] - 1].action;
+	return true;
+}
+
+template<typename ActionT>
+unsigned int Sib::BasicActionNames<ActionT>::Count()
+{
+	return (unsigned int)entries.size();
+}
+
+template<typename ActionT>
+std::string_view Sib::BasicActionNames<ActionT>::Name(unsigned int i)
+{
+	return std::string_view(pool.data() + entries[i].offset, entries[i].length);
+}
+
+template<typename ActionT>
+ActionT Sib::BasicActionNames<ActionT>::Action(unsigned int i)
+{
+	return entries[i].action;
+}
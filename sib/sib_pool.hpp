@@ -0,0 +1,249 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "sib.hpp"
+#include <algorithm>
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinderPool<MaxActions, ActionT>::SetError(Error_t error_in, const std::string& error_str_in)
+{
+	error = error_in;
+	error_str = error_str_in;
+	error_is_record = false;
+	if (error_callback) error_callback(error, error_str.c_str());
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinderPool<MaxActions, ActionT>::SetError(Error_t error_in, Sint64 value, Sint64 limit)
+{
+	error = error_in;
+	error_record = {error, value, limit};
+	error_is_record = true;
+	error_text_stale = true;
+	if (error_callback) error_callback(error, ErrorStr());
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinderPool<MaxActions, ActionT>::ValidateAction(ActionT action)
+{
+	if ((std::size_t)action >= MaxActions)
+	{
+		SetError(BAD_ACTION, action, MaxActions - 1);
+		return true;
+	}
+
+	return false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinderPool<MaxActions, ActionT>::ValidatePlayer(unsigned int player)
+{
+	if (player >= player_count)
+	{
+		SetError(BAD_PLAYER, player, (Sint64)player_count - 1);
+		return true;
+	}
+
+	return false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+Sib::Error_t Sib::BasicBinderPool<MaxActions, ActionT>::Error()
+{
+	return error;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+const char* Sib::BasicBinderPool<MaxActions, ActionT>::ErrorStr()
+{
+	if (!error_is_record) return error_str.c_str();
+
+	if (error_text_stale)
+	{
+		ErrorText(error_record, error_text, sizeof(error_text));
+		error_text_stale = false;
+	}
+
+	return error_text;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinderPool<MaxActions, ActionT>::ErrorCallback(ErrorCallback_t* ptr)
+{
+	error_callback = ptr;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+int Sib::BasicBinderPool<MaxActions, ActionT>::AddProfile(BasicBinder<MaxActions, ActionT>& binder)
+{
+	if (profiles.size() > std::numeric_limits<Uint16>::max())
+	{
+		SetError(BAD_PROFILE, profiles.size(), std::numeric_limits<Uint16>::max());
+		return -1;
+	}
+
+	// The pool has no combo state, a profile that needs it would quietly lose its chords
+	if (!binder.edit_bindings->combos.empty())
+	{
+		SetError(BAD_COMBO, "Binder pools don't support chords or sequences, the profile wasn't added");
+		return -1;
+	}
+
+	// Keycode binds come along as the scancodes they resolve to now, contexts stay with the Binder
+	Bindings& profile = profiles.emplace_back();
+	std::copy(binder.edit_bindings->offsets, binder.edit_bindings->offsets + INPUT_COUNT + 1, profile.offsets);
+	profile.actions = binder.edit_bindings->actions;
+	return (int)profiles.size() - 1;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinderPool<MaxActions, ActionT>::Players(unsigned int count)
+{
+	player_count = count;
+	player_profile.resize(count);
+	inputs_held.resize((std::size_t)count * INPUT_WORDS);
+	pressed.resize((std::size_t)count * ACTION_WORDS);
+	released.resize((std::size_t)count * ACTION_WORDS);
+	held.resize((std::size_t)count * ACTION_WORDS);
+	held_count.resize((std::size_t)count * MaxActions);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+unsigned int Sib::BasicBinderPool<MaxActions, ActionT>::Players()
+{
+	return player_count;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinderPool<MaxActions, ActionT>::PlayerProfile(unsigned int player, int profile)
+{
+	if (ValidatePlayer(player)) return;
+
+	if (profile < 0 || (std::size_t)profile >= profiles.size())
+	{
+		SetError(BAD_PROFILE, profile, (Sint64)profiles.size() - 1);
+		return;
+	}
+
+	// Held counts belong to the old tables, so the player starts over with nothing held
+	if (player_profile[player] != profile) ResetPlayer(player);
+	player_profile[player] = (Uint16)profile;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+int Sib::BasicBinderPool<MaxActions, ActionT>::PlayerProfile(unsigned int player)
+{
+	if (ValidatePlayer(player)) return -1;
+	return player_profile[player];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinderPool<MaxActions, ActionT>::ResetPlayer(unsigned int player)
+{
+	if (ValidatePlayer(player)) return;
+
+	std::fill_n(inputs_held.begin() + (std::size_t)player * INPUT_WORDS, INPUT_WORDS, 0);
+	std::fill_n(pressed.begin() + (std::size_t)player * ACTION_WORDS, ACTION_WORDS, 0);
+	std::fill_n(released.begin() + (std::size_t)player * ACTION_WORDS, ACTION_WORDS, 0);
+	std::fill_n(held.begin() + (std::size_t)player * ACTION_WORDS, ACTION_WORDS, 0);
+	std::fill_n(held_count.begin() + (std::size_t)player * MaxActions, MaxActions, 0);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinderPool<MaxActions, ActionT>::HandleEvents(const PoolEvent* events, std::size_t count)
+{
+	if (profiles.empty())
+	{
+		if (count) SetError(BAD_PROFILE, "Pool has no profiles");
+		return;
+	}
+
+	for (std::size_t e = 0; e < count; ++e)
+	{
+		const PoolEvent& event = events[e];
+		if (ValidatePlayer(event.player)) continue;
+
+		if (event.input >= INPUT_COUNT)
+		{
+			SetError(BAD_INPUT, event.input, INPUT_COUNT - 1);
+			continue;
+		}
+
+		// Presses of held inputs and releases of inputs that aren't held change nothing
+		Uint64& input_word = inputs_held[(std::size_t)event.player * INPUT_WORDS + (event.input >> 6)];
+		Uint64 input_bit = (Uint64)1 << (event.input & 63);
+		if (event.pressed == ((input_word & input_bit) != 0)) continue;
+		input_word ^= input_bit;
+
+		const Bindings& bindings = profiles[player_profile[event.player]];
+		Uint32 i = bindings.offsets[event.input];
+		Uint32 end = bindings.offsets[event.input + 1];
+
+		std::size_t row = (std::size_t)event.player * ACTION_WORDS;
+		Uint16* counts = held_count.data() + (std::size_t)event.player * MaxActions;
+
+		for (; i < end; ++i)
+		{
+			ActionT action = bindings.actions[i];
+			std::size_t word = row + (action >> 6);
+			Uint64 bit = (Uint64)1 << (action & 63);
+
+			if (event.pressed)
+			{
+				pressed[word] |= bit;
+				if (counts[action]++ == 0) held[word] |= bit;
+			}
+			else
+			{
+				released[word] |= bit;
+				if (--counts[action] == 0) held[word] &= ~bit;
+			}
+		}
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinderPool<MaxActions, ActionT>::ResetInputs()
+{
+	std::fill(pressed.begin(), pressed.end(), 0);
+	std::fill(released.begin(), released.end(), 0);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinderPool<MaxActions, ActionT>::Pressed(ActionT action, unsigned int player)
+{
+	if (ValidateAction(action) || ValidatePlayer(player)) return false;
+	return (pressed[(std::size_t)player * ACTION_WORDS + (action >> 6)] >> (action & 63)) & 1;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinderPool<MaxActions, ActionT>::Released(ActionT action, unsigned int player)
+{
+	if (ValidateAction(action) || ValidatePlayer(player)) return false;
+	return (released[(std::size_t)player * ACTION_WORDS + (action >> 6)] >> (action & 63)) & 1;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinderPool<MaxActions, ActionT>::Held(ActionT action, unsigned int player)
+{
+	if (ValidateAction(action) || ValidatePlayer(player)) return false;
+	return (held[(std::size_t)player * ACTION_WORDS + (action >> 6)] >> (action & 63)) & 1;
+}
@@ -17,248 +17,98 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
- 
+
 #include "sib.hpp"
 #include "sib_maps.hpp"
-#include <fstream>
-#include <sstream>
 
-bool Sib::Binder::ValidateActionStr(const std::string& action_str)
+bool Sib::ScancodeFromString(std::string_view str, SDL_Scancode& scancode)
 {
-	if (action_strings.find(action_str) == action_strings.end())
-	{
-		std::stringstream s;
-		s << "String \"" << action_str << "\" does not match any registered action";
-		SetError(BAD_ACTION_STR, s.str());
-		return true;
-	}
-
-	return false;
+	return FindName(scancode_list, scancode_names, str, scancode);
 }
 
-void Sib::Binder::ReadLine(const std::string& line, unsigned int n)
+bool Sib::KeycodeFromString(std::string_view str, SDL_Keycode& keycode)
 {
-	if (line.size() == 0) return;
-
-	std::string str0, str1, str2;
-	unsigned int i = 0;
-	
-	while (i < line.size() && line[i] == ' ')
-	{
-		++i;
-	}
-
-	while (i < line.size() && line[i] != ' ')
-	{
-		str0.push_back(line[i]);
-		++i;
-	}
-
-	while (i < line.size() && line[i] == ' ')
-	{
-		++i;
-	}
-
-	while (i < line.size() && line[i] != ' ')
-	{
-		str1.push_back(line[i]);
-		++i;
-	}
-
-	while (i < line.size() && line[i] == ' ')
-	{
-		++i;
-	}
+	return FindName(keycode_list, keycode_names, str, keycode);
+}
 
-	while (i < line.size() && line[i] != ' ')
-	{
-		str2.push_back(line[i]);
-		++i;
-	}
+bool Sib::MouseButtonFromString(std::string_view str, Uint8& button)
+{
+	return FindName(mbutton_list, mbutton_names, str, button);
+}
 
-	if (str0 == "scancode" || str0 == "unmap_scancode")
-	{
-		if (str_to_scancodes.find(str1) == str_to_scancodes.end())
-		{
-			std::stringstream s;
-			s << "Line " << n << ": String \"" << str1 << "\" does not match any SDL scancode";
-			SetError(BAD_SCANCODE_STR, s.str());
-			return;
-		}
+bool Sib::GamepadButtonFromString(std::string_view str, Uint8& button)
+{
+	return FindName(cbutton_list, cbutton_names, str, button);
+}
 
-		SDL_Scancode scancode = str_to_scancodes[str1];
+bool Sib::AxisFromString(std::string_view str, Sib::Axis& axis)
+{
+	return FindName(caxis_list, caxis_names, str, axis);
+}
 
-		if (str0 == "unmap_scancode")
-		{
-			UnmapScancode(scancode);
-			return;
-		}
+bool Sib::CommandFromString(std::string_view str, Sib::Command& command)
+{
+	return FindName(command_list, command_names, str, command);
+}
 
-		if (ValidateActionStr(str2)) return;
-		MapScancode(str_to_scancodes[str1], action_strings[str2]);
-	}
-	else if (str0 == "keycode" || str0 == "unmap_keycode")
-	{
-		if (str_to_keycodes.find(str1) == str_to_keycodes.end())
-		{
-			std::stringstream s;
-			s << "Line " << n << ": String \"" << str1 << "\" does not match any SDL keycode";
-			SetError(BAD_KEYCODE_STR, s.str());
-			return;
-		}
+std::string_view Sib::ScancodeToString(SDL_Scancode scancode)
+{
+	return FindValue(scancode_values, scancode);
+}
 
-		SDL_Scancode scancode = SDL_GetScancodeFromKey(str_to_keycodes[str1]);
+std::string_view Sib::KeycodeToString(SDL_Keycode keycode)
+{
+	return FindValue(keycode_values, keycode);
+}
 
-		if (scancode == SDL_SCANCODE_UNKNOWN)
-		{
-			std::stringstream s;
-			s << "Line " << n << ": Keycode " << SDL_GetKeyName(str_to_keycodes[str1]) << " has no matching scancode";
-			SetError(NO_SCANCODE, s.str());
-			return;
-		}
+std::string_view Sib::MouseButtonToString(Uint8 button)
+{
+	return FindValue(mbutton_values, button);
+}
 
-		if (str0 == "unmap_keycode")
-		{
-			UnmapScancode(scancode);
-			return;
-		}
+std::string_view Sib::GamepadButtonToString(Uint8 button)
+{
+	return FindValue(cbutton_values, button);
+}
 
-		if (ValidateActionStr(str2)) return;
-		MapScancode(scancode, action_strings[str2]);
-	}
-	else if (str0 == "mbutton" || str0 == "unmap_mbutton")
-	{
-		if (str_to_mbuttons.find(str1) == str_to_mbuttons.end())
-		{
-			std::stringstream s;
-			s << "Line " << n << ": String \"" << str1 << "\" does not match any SDL mouse button";
-			SetError(BAD_MB_STR, s.str());
-			return;
-		}
+std::string_view Sib::AxisToString(Sib::Axis axis)
+{
+	return FindValue(caxis_values, axis);
+}
 
-		Uint8 button = str_to_mbuttons[str1];
+std::string_view Sib::CommandToString(Sib::Command command)
+{
+	return FindValue(command_values, command);
+}
 
-		if (str0 == "unmap_mbutton")
-		{
-			UnmapMouseButton(button);
-		}
+Sib::Command Sib::InputToString(unsigned int input, std::string_view& name)
+{
+	name = std::string_view();
 
-		if (ValidateActionStr(str2)) return;
-		MapMouseButton(button, action_strings[str2]);
-	}
-	else if (str0 == "cbutton" || str0 == "unmap_cbutton")
+	if (input < INPUT_CBUTTON)
 	{
-		if (str_to_cbuttons.find(str1) == str_to_cbuttons.end())
-		{
-			std::stringstream s;
-			s << "Line " << n << ": String \"" << str1 << "\" does not match any SDL controller button";
-			SetError(BAD_CBUTTON_STR, s.str());
-			return;
-		}
-
-		Uint8 button = str_to_cbuttons[str1];
-
-		if (str0 == "unmap_cbutton")
-		{
-			UnmapGamepadButton(button);
-			return;
-		}
-
-		if (ValidateActionStr(str2)) return;
-		MapGamepadButton(button, action_strings[str2]);
+		name = ScancodeToString((SDL_Scancode)(input - INPUT_SCANCODE));
+		return Command::Scancode;
 	}
-	else if (str0 == "caxis" || str0 == "unmap_caxis")
-	{
-		if (str_to_caxis.find(str1) == str_to_caxis.end())
-		{
-			std::stringstream s;
-			s << "Line " << n << ": String \"" << str1 << "\" is not a valid axis";
-			SetError(BAD_AXIS_STR, s.str());
-			return;
-		}
-
-		Sib::Axis axis = str_to_caxis[str1];
 
-		if (str0 == "unmap_caxis")
-		{
-			UnmapGamepadAxis(axis);
-			return;
-		}
-
-		if (ValidateActionStr(str2)) return;
-		MapGamepadAxis(axis, action_strings[str2]);
-	}
-	else if (str0 == "wheelup")
+	if (input < INPUT_CAXIS)
 	{
-		if (ValidateActionStr(str1)) return;
-		MapMouseWheelUp(action_strings[str1]);
+		name = GamepadButtonToString((Uint8)(input - INPUT_CBUTTON));
+		return Command::GamepadButton;
 	}
-	else if (str0 == "unmap_wheelup")
-	{
-		UnmapMouseWheelUp();
-	}
-	else if (str0 == "wheeldown")
-	{
-		if (ValidateActionStr(str1)) return;
-		MapMouseWheelDown(action_strings[str1]);
-	}
-	else if (str0 == "unmap_wheeldown")
-	{
-		UnmapMouseWheelDown();
-	}
-	else if (str0 == "wheelleft")
-	{
-		if (ValidateActionStr(str1)) return;
-		MapMouseWheelLeft(action_strings[str1]);
-	}
-	else if (str0 == "unmap_wheelleft")
-	{
-		UnmapMouseWheelLeft();
-	}
-	else if (str0 == "wheelright")
-	{
-		if (ValidateActionStr(str1)) return;
-		MapMouseWheelRight(action_strings[str1]);
-	}
-	else if (str0 == "unmap_wheelright")
-	{
-		UnmapMouseWheelRight();
-	}
-	else
-	{
-		std::stringstream s;
-		s << "Line " << n << ": String \"" << str0 << "\" is not a valid bind command";
-		SetError(BAD_COMMAND, s.str());
-		return;
-	}
-}
 
-void Sib::Binder::ReadFile(std::filesystem::path path)
-{
-	std::ifstream file(path);
-
-	if (file.fail())
+	if (input < INPUT_MBUTTON)
 	{
-		std::stringstream s;
-		s << "Failed to open file: " << path.string(); 	
-		SetError(OPEN_FILE, s.str());
-		return;
+		name = AxisToString((Sib::Axis)(input - INPUT_CAXIS));
+		return Command::GamepadAxis;
 	}
 
-	unsigned int n = 0;
-	std::string line;
-	while (true)
+	if (input < INPUT_WHEEL)
 	{
-		if (file.eof()) break;
-		std::getline(file, line);
-		ReadLine(line, n);
-		++n;
+		name = MouseButtonToString((Uint8)(input - INPUT_MBUTTON + 1));
+		return Command::MouseButton;
 	}
-}
 
-void Sib::Binder::ActionSetString(Sib::Action_t action, const std::string& action_str)
-{
-	if (ValidateAction(action)) return;
-	action_strings[action_str] = action;	
+	static constexpr Command wheels[] = {Command::WheelLeft, Command::WheelRight, Command::WheelDown, Command::WheelUp};
+	return wheels[(input - INPUT_WHEEL) & 3];
 }
-
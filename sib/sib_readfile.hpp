@@ -0,0 +1,817 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "sib.hpp"
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ValidateActionStr(std::string_view action_str, ActionT& action)
+{
+	if (action_strings.Find(action_str, action)) return false;
+
+	if (auto_actions)
+	{
+		while (next_auto_action < MaxActions && named_actions[next_auto_action]) ++next_auto_action;
+
+		if (next_auto_action < MaxActions)
+		{
+			action = (ActionT)next_auto_action;
+			ActionSetString(action, action_str);
+			return false;
+		}
+
+		std::stringstream s;
+		s << "No action left for string \"" << action_str << "\", all " << MaxActions << " have names";
+		SetError(BAD_ACTION_STR, s.str());
+		return true;
+	}
+
+	std::stringstream s;
+	s << "String \"" << action_str << "\" does not match any registered action";
+	SetError(BAD_ACTION_STR, s.str());
+	return true;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ReadLine(std::string_view line, unsigned int n)
+{
+	// Split the line into at most five tokens, pointing into the line instead of copying it
+	std::string_view str[5];
+	unsigned int count = 0;
+	std::size_t i = 0;
+
+	while (count < 5)
+	{
+		while (i < line.size() && (line[i] == ' ' || line[i] == '\t' || line[i] == '\r'))
+		{
+			++i;
+		}
+
+		if (i == line.size()) break;
+
+		std::size_t start = i;
+
+		while (i < line.size() && line[i] != ' ' && line[i] != '\t' && line[i] != '\r')
+		{
+			++i;
+		}
+
+		str[count] = line.substr(start, i - start);
+		++count;
+	}
+
+	if (count == 0) return;
+
+	Command command;
+
+	if (!CommandFromString(str[0], command))
+	{
+		std::stringstream s;
+		s << "Line " << n << ": String \"" << str[0] << "\" is not a valid bind command";
+		SetError(BAD_COMMAND, s.str());
+		return;
+	}
+
+	ActionT action;
+
+	switch (command)
+	{
+	case Command::Scancode:
+	case Command::Unmap_Scancode:
+	{
+		SDL_Scancode scancode;
+
+		if (!ScancodeFromString(str[1], scancode))
+		{
+			std::stringstream s;
+			s << "Line " << n << ": String \"" << str[1] << "\" does not match any SDL scancode";
+			SetError(BAD_SCANCODE_STR, s.str());
+			return;
+		}
+
+		if (command == Command::Unmap_Scancode)
+		{
+			UnmapScancode(scancode);
+			return;
+		}
+
+		if (ValidateActionStr(str[2], action)) return;
+		MapScancode(scancode, action);
+		break;
+	}
+	case Command::Keycode:
+	case Command::Unmap_Keycode:
+	{
+		SDL_Keycode keycode;
+
+		if (!KeycodeFromString(str[1], keycode))
+		{
+			std::stringstream s;
+			s << "Line " << n << ": String \"" << str[1] << "\" does not match any SDL keycode";
+			SetError(BAD_KEYCODE_STR, s.str());
+			return;
+		}
+
+		if (command == Command::Unmap_Keycode)
+		{
+			UnmapKeycode(keycode);
+			return;
+		}
+
+		if (ValidateActionStr(str[2], action)) return;
+		MapKeycode(keycode, action);
+		break;
+	}
+	case Command::MouseButton:
+	case Command::Unmap_MouseButton:
+	{
+		Uint8 button;
+
+		if (!MouseButtonFromString(str[1], button))
+		{
+			std::stringstream s;
+			s << "Line " << n << ": String \"" << str[1] << "\" does not match any SDL mouse button";
+			SetError(BAD_MB_STR, s.str());
+			return;
+		}
+
+		if (command == Command::Unmap_MouseButton)
+		{
+			UnmapMouseButton(button);
+			return;
+		}
+
+		if (ValidateActionStr(str[2], action)) return;
+		MapMouseButton(button, action);
+		break;
+	}
+	case Command::GamepadButton:
+	case Command::Unmap_GamepadButton:
+	{
+		Uint8 button;
+
+		if (!GamepadButtonFromString(str[1], button))
+		{
+			std::stringstream s;
+			s << "Line " << n << ": String \"" << str[1] << "\" does not match any SDL controller button";
+			SetError(BAD_CBUTTON_STR, s.str());
+			return;
+		}
+
+		if (command == Command::Unmap_GamepadButton)
+		{
+			UnmapGamepadButton(button);
+			return;
+		}
+
+		if (ValidateActionStr(str[2], action)) return;
+		MapGamepadButton(button, action);
+		break;
+	}
+	case Command::GamepadAxis:
+	case Command::Unmap_GamepadAxis:
+	{
+		Sib::Axis axis;
+
+		if (!AxisFromString(str[1], axis))
+		{
+			std::stringstream s;
+			s << "Line " << n << ": String \"" << str[1] << "\" is not a valid axis";
+			SetError(BAD_AXIS_STR, s.str());
+			return;
+		}
+
+		if (command == Command::Unmap_GamepadAxis)
+		{
+			UnmapGamepadAxis(axis);
+			return;
+		}
+
+		if (ValidateActionStr(str[2], action)) return;
+		MapGamepadAxis(axis, action);
+		break;
+	}
+	case Command::WheelUp:
+		if (ValidateActionStr(str[1], action)) return;
+		MapMouseWheelUp(action);
+		break;
+	case Command::Unmap_WheelUp:
+		UnmapMouseWheelUp();
+		break;
+	case Command::WheelDown:
+		if (ValidateActionStr(str[1], action)) return;
+		MapMouseWheelDown(action);
+		break;
+	case Command::Unmap_WheelDown:
+		UnmapMouseWheelDown();
+		break;
+	case Command::WheelLeft:
+		if (ValidateActionStr(str[1], action)) return;
+		MapMouseWheelLeft(action);
+		break;
+	case Command::Unmap_WheelLeft:
+		UnmapMouseWheelLeft();
+		break;
+	case Command::WheelRight:
+		if (ValidateActionStr(str[1], action)) return;
+		MapMouseWheelRight(action);
+		break;
+	case Command::Unmap_WheelRight:
+		UnmapMouseWheelRight();
+		break;
+	case Command::Chord:
+	case Command::Sequence:
+	{
+		Combo combo = {};
+		combo.chord = command == Command::Chord;
+		DeferredCombo deferred = {};
+
+		if (ReadCombo(str[1], str[2], combo, n, staging ? deferred.keycodes : nullptr)) return;
+
+		if (combo.chord && combo.step_count != 1)
+		{
+			std::stringstream s;
+			s << "Line " << n << ": Chords have a single step, \"" << str[2] << "\" needs to be a sequence";
+			SetError(BAD_COMBO, s.str());
+			return;
+		}
+
+		std::string_view action_str = str[3];
+
+		if (!combo.chord)
+		{
+			const char* end = str[3].data() + str[3].size();
+			std::from_chars_result result = std::from_chars(str[3].data(), end, combo.window);
+
+			if (str[3].empty() || result.ec != std::errc() || result.ptr != end)
+			{
+				std::stringstream s;
+				s << "Line " << n << ": String \"" << str[3] << "\" is not a time in milliseconds";
+				SetError(BAD_COMBO, s.str());
+				return;
+			}
+
+			action_str = str[4];
+		}
+
+		if (ValidateActionStr(action_str, action)) return;
+
+		if (deferred.keycodes[0][0] != SDLK_UNKNOWN)
+		{
+			deferred.combo = combo;
+			deferred.combo.action = action;
+			deferred.line = n;
+			staging->combos.push_back(deferred);
+			break;
+		}
+
+		AddCombo(combo, action);
+		break;
+	}
+	case Command::Unmap_Combo:
+		if (ValidateActionStr(str[1], action)) return;
+		UnmapCombos(action);
+		break;
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ReadCombo(std::string_view kind_str, std::string_view str, Combo& combo, unsigned int n,
+	SDL_Keycode (*keycodes)[COMBO_STEP_INPUTS])
+{
+	Command kind;
+
+	if (!CommandFromString(kind_str, kind) || (kind != Command::Scancode && kind != Command::Keycode &&
+		kind != Command::MouseButton && kind != Command::GamepadButton && kind != Command::GamepadAxis))
+	{
+		std::stringstream s;
+		s << "Line " << n << ": String \"" << kind_str << "\" is not scancode, keycode, mbutton, cbutton or caxis";
+		SetError(BAD_COMBO, s.str());
+		return true;
+	}
+
+	// Steps are separated by commas and the inputs of a step by plus signs: DOWN,DOWN+RIGHT,RIGHT+X
+	std::size_t step_start = 0;
+
+	while (true)
+	{
+		std::size_t step_end = str.find(',', step_start);
+		if (step_end == std::string_view::npos) step_end = str.size();
+		std::string_view step = str.substr(step_start, step_end - step_start);
+
+		if (ComboStep(combo)) return true;
+
+		std::size_t name_start = 0;
+
+		while (true)
+		{
+			std::size_t name_end = step.find('+', name_start);
+			if (name_end == std::string_view::npos) name_end = step.size();
+			std::string_view name = step.substr(name_start, name_end - name_start);
+			unsigned int input;
+
+			switch (kind)
+			{
+			case Command::Scancode:
+			{
+				SDL_Scancode scancode;
+
+				if (!ScancodeFromString(name, scancode))
+				{
+					std::stringstream s;
+					s << "Line " << n << ": String \"" << name << "\" does not match any SDL scancode";
+					SetError(BAD_SCANCODE_STR, s.str());
+					return true;
+				}
+
+				input = INPUT_SCANCODE + scancode;
+				break;
+			}
+			case Command::Keycode:
+			{
+				SDL_Keycode keycode;
+
+				if (!KeycodeFromString(name, keycode))
+				{
+					std::stringstream s;
+					s << "Line " << n << ": String \"" << name << "\" does not match any SDL keycode";
+					SetError(BAD_KEYCODE_STR, s.str());
+					return true;
+				}
+
+				// Kept for SwapStagedBindings() to look up, the input is a placeholder until then
+				if (keycodes)
+				{
+					Uint8 slot = combo.step_size[combo.step_count - 1];
+					if (slot < COMBO_STEP_INPUTS) keycodes[combo.step_count - 1][slot] = keycode;
+					input = INPUT_SCANCODE;
+					break;
+				}
+
+				SDL_Scancode scancode = SDL_GetScancodeFromKey(keycode);
+
+				if (scancode == SDL_SCANCODE_UNKNOWN)
+				{
+					std::stringstream s;
+					s << "Line " << n << ": Keycode " << SDL_GetKeyName(keycode) << " has no matching scancode";
+					SetError(NO_SCANCODE, s.str());
+					return true;
+				}
+
+				input = INPUT_SCANCODE + scancode;
+				break;
+			}
+			case Command::MouseButton:
+			{
+				Uint8 button;
+
+				if (!MouseButtonFromString(name, button))
+				{
+					std::stringstream s;
+					s << "Line " << n << ": String \"" << name << "\" does not match any SDL mouse button";
+					SetError(BAD_MB_STR, s.str());
+					return true;
+				}
+
+				input = INPUT_MBUTTON + button - 1;
+				break;
+			}
+			case Command::GamepadButton:
+			{
+				Uint8 button;
+
+				if (!GamepadButtonFromString(name, button))
+				{
+					std::stringstream s;
+					s << "Line " << n << ": String \"" << name << "\" does not match any SDL controller button";
+					SetError(BAD_CBUTTON_STR, s.str());
+					return true;
+				}
+
+				input = INPUT_CBUTTON + button;
+				break;
+			}
+			default:
+			{
+				Sib::Axis axis;
+
+				if (!AxisFromString(name, axis))
+				{
+					std::stringstream s;
+					s << "Line " << n << ": String \"" << name << "\" is not a valid axis";
+					SetError(BAD_AXIS_STR, s.str());
+					return true;
+				}
+
+				input = INPUT_CAXIS + (unsigned int)axis;
+				break;
+			}
+			}
+
+			if (ComboInput(combo, input)) return true;
+			if (name_end == step.size()) break;
+			name_start = name_end + 1;
+		}
+
+		if (step_end == str.size()) return false;
+		step_start = step_end + 1;
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::LoadFile(const std::filesystem::path& path, std::size_t& size)
+{
+	// Unbuffered, the file is read straight into file_buffer in one go
+	std::ifstream file;
+	file.rdbuf()->pubsetbuf(0, 0);
+	file.open(path, std::ios::binary | std::ios::ate);
+
+	if (file.fail())
+	{
+		std::stringstream s;
+		s << "Failed to open file: " << path.string(); 	
+		SetError(OPEN_FILE, s.str());
+		return true;
+	}
+
+	std::streamsize file_size = file.tellg();
+	file.seekg(0);
+
+	if (file_size < 0)
+	{
+		std::stringstream s;
+		s << "Failed to read file: " << path.string();
+		SetError(OPEN_FILE, s.str());
+		return true;
+	}
+
+	if (file_buffer.size() < (std::size_t)file_size) file_buffer.resize(file_size);
+	file.read(file_buffer.data(), file_size);
+	size = (std::size_t)file.gcount();
+	return false;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ReadFile(std::filesystem::path path)
+{
+	std::size_t size;
+	if (LoadFile(path, size)) return;
+	ReadString(std::string_view(file_buffer.data(), size));
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ReadString(std::string_view text)
+{
+	const char* line = text.data();
+	const char* end = line + text.size();
+	unsigned int n = 0;
+
+	while (line < end)
+	{
+		const char* eol = (const char*)std::memchr(line, '\n', end - line);
+		if (!eol) eol = end;
+
+		ReadLine(std::string_view(line, eol - line), n);
+		++n;
+		line = eol + 1;
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::SaveFile(std::filesystem::path path)
+{
+	std::ofstream file(path, std::ios::binary);
+
+	if (file.fail())
+	{
+		std::stringstream s;
+		s << "Failed to open file: " << path.string();
+		SetError(OPEN_FILE, s.str());
+		return;
+	}
+
+	std::vector<std::string_view> names(MaxActions);
+
+	for (unsigned int i = 0; i < action_strings.Count(); ++i)
+	{
+		ActionT action = action_strings.Action(i);
+		if (names[action].empty()) names[action] = action_strings.Name(i);
+	}
+
+	const Bindings& source = *edit_bindings;
+	std::size_t unnamed = 0;
+
+	for (std::size_t action = 0; action < MaxActions && !source.action_offsets.empty(); ++action)
+	{
+		Uint32 end = source.action_offsets[action + 1];
+
+		if (names[action].empty())
+		{
+			unnamed += end - source.action_offsets[action];
+			continue;
+		}
+
+		for (Uint32 i = source.action_offsets[action]; i < end; ++i)
+		{
+			unsigned int input = source.action_inputs[i];
+
+			// Entries a keycode bind added are written as that keycode below, explicit scancode binds
+			// of the same key stay
+			if (input < INPUT_CBUTTON && std::any_of(source.keycodes.begin(), source.keycodes.end(),
+				[input, action](const BasicKeycodeBind<ActionT>& bind) { return bind.owner && bind.scancode == (SDL_Scancode)input && bind.action == action; }))
+			{
+				continue;
+			}
+
+			std::string_view name;
+			Command command = InputToString(input, name);
+			file << CommandToString(command) << ' ';
+			if (!name.empty()) file << name << ' ';
+			file << names[action] << '\n';
+		}
+	}
+
+	for (const BasicKeycodeBind<ActionT>& bind : source.keycodes)
+	{
+		// Keycodes that own their entry were already counted with the inputs of the action
+		if (names[bind.action].empty())
+		{
+			if (!bind.owner) ++unnamed;
+			continue;
+		}
+
+		file << "keycode " << KeycodeToString(bind.keycode) << ' ' << names[bind.action] << '\n';
+	}
+
+	for (const Combo& combo : source.combos)
+	{
+		if (names[combo.action].empty())
+		{
+			++unnamed;
+			continue;
+		}
+
+		std::string_view name;
+		Command kind = InputToString(combo.inputs[0][0], name);
+		file << (combo.chord ? "chord " : "sequence ") << CommandToString(kind) << ' ';
+
+		for (unsigned int step = 0; step < combo.step_count; ++step)
+		{
+			if (step) file << ',';
+
+			for (unsigned int i = 0; i < combo.step_size[step]; ++i)
+			{
+				InputToString(combo.inputs[step][i], name);
+				if (i) file << '+';
+				file << name;
+			}
+		}
+
+		if (!combo.chord) file << ' ' << combo.window;
+		file << ' ' << names[combo.action] << '\n';
+	}
+
+	if (file.fail())
+	{
+		std::stringstream s;
+		s << "Failed to write file: " << path.string();
+		SetError(OPEN_FILE, s.str());
+		return;
+	}
+
+	if (unnamed)
+	{
+		std::stringstream s;
+		s << unnamed << " binds of actions without an action string were not saved to " << path.string();
+		SetError(BAD_ACTION_STR, s.str());
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::SaveCompiled(std::filesystem::path path)
+{
+	CompiledHeader header;
+	header.magic = COMPILED_MAGIC;
+	header.version = COMPILED_VERSION;
+	header.max_actions = (Uint32)MaxActions;
+	header.action_size = (Uint32)sizeof(ActionT);
+	header.input_count = INPUT_COUNT;
+	header.action_count = (Uint32)edit_bindings->actions.size();
+	header.combo_size = (Uint32)sizeof(Combo);
+	header.combo_count = (Uint32)edit_bindings->combos.size();
+
+	std::ofstream file(path, std::ios::binary);
+
+	if (file.fail())
+	{
+		std::stringstream s;
+		s << "Failed to open file: " << path.string();
+		SetError(OPEN_FILE, s.str());
+		return;
+	}
+
+	file.write((const char*)&header, sizeof(header));
+	file.write((const char*)edit_bindings->offsets, sizeof(edit_bindings->offsets));
+	file.write((const char*)edit_bindings->actions.data(), edit_bindings->actions.size() * sizeof(ActionT));
+
+	// Combos are written field by field over zeroed bytes, so padding and unused steps don't make two
+	// saves of the same bindings differ
+	for (const Combo& combo : edit_bindings->combos)
+	{
+		char bytes[sizeof(Combo)] = {};
+
+		for (unsigned int step = 0; step < combo.step_count; ++step)
+		{
+			std::memcpy(bytes + offsetof(Combo, inputs) + sizeof(combo.inputs[0]) * step, combo.inputs[step], combo.step_size[step] * sizeof(Uint16));
+			bytes[offsetof(Combo, step_size) + step] = (char)combo.step_size[step];
+		}
+
+		bytes[offsetof(Combo, step_count)] = (char)combo.step_count;
+		bytes[offsetof(Combo, chord)] = combo.chord ? 1 : 0;
+		std::memcpy(bytes + offsetof(Combo, window), &combo.window, sizeof(combo.window));
+		std::memcpy(bytes + offsetof(Combo, action), &combo.action, sizeof(combo.action));
+		file.write(bytes, sizeof(bytes));
+	}
+
+	if (file.fail())
+	{
+		std::stringstream s;
+		s << "Failed to write file: " << path.string();
+		SetError(OPEN_FILE, s.str());
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::LoadCompiled(std::filesystem::path path)
+{
+	std::size_t size;
+	if (LoadFile(path, size)) return;
+
+	const char* data = file_buffer.data();
+	CompiledHeader header;
+
+	if (size >= sizeof(header)) std::memcpy(&header, data, sizeof(header));
+
+	if (size < sizeof(header) || header.magic != COMPILED_MAGIC)
+	{
+		std::stringstream s;
+		s << "File is not a compiled profile: " << path.string();
+		SetError(BAD_COMPILED, s.str());
+		return;
+	}
+
+	if (header.version != COMPILED_VERSION || header.max_actions != MaxActions || header.action_size != sizeof(ActionT) ||
+		header.input_count != INPUT_COUNT || header.combo_size != sizeof(Combo))
+	{
+		std::stringstream s;
+		s << "Compiled profile " << path.string() << " (version " << header.version << ", " << header.max_actions
+			<< " actions) doesn't match this Binder (version " << COMPILED_VERSION << ", " << MaxActions << " actions)";
+		SetError(BAD_COMPILED, s.str());
+		return;
+	}
+
+	const char* offsets = data + sizeof(header);
+	const char* actions = offsets + sizeof(bindings.offsets);
+	const char* combos = actions + (std::size_t)header.action_count * sizeof(ActionT);
+
+	if (size != sizeof(header) + sizeof(bindings.offsets) + (std::size_t)header.action_count * sizeof(ActionT) +
+		(std::size_t)header.combo_count * sizeof(Combo))
+	{
+		std::stringstream s;
+		s << "Compiled profile " << path.string() << " has the wrong size";
+		SetError(BAD_COMPILED, s.str());
+		return;
+	}
+
+	// Check everything before touching the current bindings, so a bad file leaves them as they were
+	Uint32 previous = 0;
+
+	for (unsigned int i = 0; i <= INPUT_COUNT; ++i)
+	{
+		Uint32 offset;
+		std::memcpy(&offset, offsets + i * sizeof(Uint32), sizeof(Uint32));
+		bool bad = i == 0 ? offset != 0 : offset < previous;
+
+		if (bad || (i == INPUT_COUNT && offset != header.action_count))
+		{
+			std::stringstream s;
+			s << "Compiled profile " << path.string() << " has a bad offset table";
+			SetError(BAD_COMPILED, s.str());
+			return;
+		}
+
+		previous = offset;
+	}
+
+	if constexpr (MaxActions - 1 < std::numeric_limits<ActionT>::max())
+	{
+		for (Uint32 i = 0; i < header.action_count; ++i)
+		{
+			ActionT action;
+			std::memcpy(&action, actions + i * sizeof(ActionT), sizeof(ActionT));
+
+			if (action >= MaxActions)
+			{
+				std::stringstream s;
+				s << "Compiled profile " << path.string() << " has an action out of range";
+				SetError(BAD_COMPILED, s.str());
+				return;
+			}
+		}
+	}
+
+	if (header.combo_count > SIB_MAX_COMBOS)
+	{
+		std::stringstream s;
+		s << "Compiled profile " << path.string() << " has " << header.combo_count << " combos, the limit is " << SIB_MAX_COMBOS;
+		SetError(BAD_COMPILED, s.str());
+		return;
+	}
+
+	for (Uint32 i = 0; i < header.combo_count; ++i)
+	{
+		// Only 0 and 1 are valid bools, check the byte before copying it into one
+		Uint8 chord = (Uint8)combos[i * sizeof(Combo) + offsetof(Combo, chord)];
+		Combo combo = {};
+		if (chord <= 1) std::memcpy(&combo, combos + i * sizeof(Combo), sizeof(Combo));
+
+		// The same rules AddCombo() applies to text profiles
+		bool bad = chord > 1 || combo.step_count == 0 || combo.step_count > SIB_COMBO_STEPS || (std::size_t)combo.action >= MaxActions ||
+			(combo.chord ? combo.step_count != 1 || combo.window != 0 : combo.step_count < 2);
+
+		for (unsigned int step = 0; !bad && step < combo.step_count; ++step)
+		{
+			bad = combo.step_size[step] == 0 || combo.step_size[step] > COMBO_STEP_INPUTS;
+
+			for (unsigned int j = 0; !bad && j < combo.step_size[step]; ++j)
+			{
+				bad = combo.inputs[step][j] >= INPUT_COUNT;
+			}
+		}
+
+		if (bad)
+		{
+			std::stringstream s;
+			s << "Compiled profile " << path.string() << " has a bad chord or sequence";
+			SetError(BAD_COMPILED, s.str());
+			return;
+		}
+	}
+
+	Bindings loaded;
+	std::memcpy(loaded.offsets, offsets, sizeof(loaded.offsets));
+	loaded.actions.resize(header.action_count);
+	if (header.action_count) std::memcpy(loaded.actions.data(), actions, header.action_count * sizeof(ActionT));
+	loaded.combos.resize(header.combo_count);
+	if (header.combo_count) std::memcpy(loaded.combos.data(), combos, header.combo_count * sizeof(Combo));
+	BuildComboIndex(loaded);
+	BuildActionIndex(loaded);
+
+	// Replacing the live table resets the combos and releases held inputs whose actions change, the
+	// same as a context switch
+	if (edit_bindings == active_bindings) ReleaseChangedInputs(loaded);
+	*edit_bindings = std::move(loaded);
+	if (!merged_bindings.empty()) merged_dirty = true;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ActionSetString(ActionT action, std::string_view action_str)
+{
+	if (ValidateAction(action)) return;
+	action_strings.Set(action_str, action);
+	named_actions.set(action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicBinder<MaxActions, ActionT>::ActionFromString(std::string_view action_str, ActionT& action)
+{
+	return action_strings.Find(action_str, action);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::AutoActions(bool enable)
+{
+	auto_actions = enable;
+}
@@ -0,0 +1,260 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "sib.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::RecordEvents(std::vector<RecordedEvent>* record)
+{
+	event_record = record;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::RecordEvent(const SDL_Event& event)
+{
+	RecordedEvent recorded = {event.common.timestamp, event.type, 0, 0, 0};
+
+	switch (event.type)
+	{
+	default:
+		return;
+	case SDL_KEYDOWN:
+	case SDL_KEYUP:
+		recorded.code = (Sint16)event.key.keysym.scancode;
+		recorded.value = event.key.state;
+		break;
+	case SDL_MOUSEBUTTONDOWN:
+	case SDL_MOUSEBUTTONUP:
+		recorded.code = event.button.button;
+		recorded.value = event.button.state;
+		break;
+	case SDL_MOUSEWHEEL:
+		// Flipped wheels are stored as normal ones moving the other way
+		recorded.code = (Sint16)std::clamp(event.wheel.x, -32768, 32767);
+		recorded.value = (Sint16)std::clamp(event.wheel.y, -32768, 32767);
+
+		if (event.wheel.direction == SDL_MOUSEWHEEL_FLIPPED)
+		{
+			recorded.code = -recorded.code;
+			recorded.value = -recorded.value;
+		}
+		break;
+	case SDL_CONTROLLERBUTTONDOWN:
+	case SDL_CONTROLLERBUTTONUP:
+		recorded.which = event.cbutton.which;
+		recorded.code = event.cbutton.button;
+		recorded.value = event.cbutton.state;
+		break;
+	case SDL_CONTROLLERAXISMOTION:
+		recorded.which = event.caxis.which;
+		recorded.code = event.caxis.axis;
+		recorded.value = event.caxis.value;
+		break;
+	case SDL_CONTROLLERDEVICEADDED:
+		// Keep the instance id, the device index means nothing without the device
+		recorded.which = SDL_JoystickGetDeviceInstanceID(event.cdevice.which);
+		break;
+	case SDL_CONTROLLERDEVICEREMOVED:
+		recorded.which = event.cdevice.which;
+		break;
+	case SDL_KEYMAPCHANGED:
+		break;
+	}
+
+	event_record->push_back(recorded);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ReplayEvent(const RecordedEvent& recorded)
+{
+	SDL_Event event = {};
+	event.type = recorded.type;
+	event.common.timestamp = recorded.timestamp;
+
+	switch (recorded.type)
+	{
+	case 0:
+		event_timestamp = recorded.timestamp;
+		ResetInputs();
+		return;
+	case SDL_KEYDOWN:
+	case SDL_KEYUP:
+		event.key.keysym.scancode = (SDL_Scancode)recorded.code;
+		event.key.state = (Uint8)recorded.value;
+		break;
+	case SDL_MOUSEBUTTONDOWN:
+	case SDL_MOUSEBUTTONUP:
+		event.button.button = (Uint8)recorded.code;
+		event.button.state = (Uint8)recorded.value;
+		break;
+	case SDL_MOUSEWHEEL:
+		event.wheel.x = recorded.code;
+		event.wheel.y = recorded.value;
+		event.wheel.direction = SDL_MOUSEWHEEL_NORMAL;
+		break;
+	case SDL_CONTROLLERBUTTONDOWN:
+	case SDL_CONTROLLERBUTTONUP:
+		event.cbutton.which = recorded.which;
+		event.cbutton.button = (Uint8)recorded.code;
+		event.cbutton.state = (Uint8)recorded.value;
+		break;
+	case SDL_CONTROLLERAXISMOTION:
+		event.caxis.which = recorded.which;
+		event.caxis.axis = (Uint8)recorded.code;
+		event.caxis.value = recorded.value;
+		break;
+	case SDL_CONTROLLERDEVICEADDED:
+		// The record already has the instance id, skip the SDL lookup in HandleInput()
+		event_timestamp = recorded.timestamp;
+		if (event_record) event_record->push_back(recorded);
+		AddController(recorded.which);
+		return;
+	case SDL_CONTROLLERDEVICEREMOVED:
+		event.cdevice.which = recorded.which;
+		break;
+	}
+
+	HandleInput(event);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::ReplayEvents(const RecordedEvent* events, std::size_t count)
+{
+	for (std::size_t i = 0; i < count; ++i) ReplayEvent(events[i]);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::SaveRecord(std::filesystem::path path, const std::vector<RecordedEvent>& record)
+{
+	RecordHeader header;
+	header.magic = RECORD_MAGIC;
+	header.version = RECORD_VERSION;
+	header.event_size = (Uint32)sizeof(RecordedEvent);
+	header.event_count = (Uint32)record.size();
+
+	std::ofstream file(path, std::ios::binary);
+
+	if (file.fail())
+	{
+		std::stringstream s;
+		s << "Failed to open file: " << path.string();
+		SetError(OPEN_FILE, s.str());
+		return;
+	}
+
+	file.write((const char*)&header, sizeof(header));
+	file.write((const char*)record.data(), record.size() * sizeof(RecordedEvent));
+
+	if (file.fail())
+	{
+		std::stringstream s;
+		s << "Failed to write file: " << path.string();
+		SetError(OPEN_FILE, s.str());
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicBinder<MaxActions, ActionT>::LoadRecord(std::filesystem::path path, std::vector<RecordedEvent>& record)
+{
+	std::size_t size;
+	if (LoadFile(path, size)) return;
+
+	const char* data = file_buffer.data();
+	RecordHeader header;
+
+	if (size >= sizeof(header)) std::memcpy(&header, data, sizeof(header));
+
+	if (size < sizeof(header) || header.magic != RECORD_MAGIC)
+	{
+		std::stringstream s;
+		s << "File is not an event record: " << path.string();
+		SetError(BAD_RECORD, s.str());
+		return;
+	}
+
+	if (header.version != RECORD_VERSION || header.event_size != sizeof(RecordedEvent))
+	{
+		std::stringstream s;
+		s << "Event record was saved by a different version: " << path.string();
+		SetError(BAD_RECORD, s.str());
+		return;
+	}
+
+	if (size != sizeof(header) + (std::size_t)header.event_count * sizeof(RecordedEvent))
+	{
+		std::stringstream s;
+		s << "Event record is truncated: " << path.string();
+		SetError(BAD_RECORD, s.str());
+		return;
+	}
+
+	// Replay indexes the binding tables with the codes, so check every event before handing any back
+	for (Uint32 i = 0; i < header.event_count; ++i)
+	{
+		RecordedEvent recorded;
+		std::memcpy(&recorded, data + sizeof(header) + (std::size_t)i * sizeof(RecordedEvent), sizeof(RecordedEvent));
+		bool bad;
+
+		switch (recorded.type)
+		{
+		case 0:
+		case SDL_MOUSEWHEEL:
+		case SDL_CONTROLLERDEVICEADDED:
+		case SDL_CONTROLLERDEVICEREMOVED:
+		case SDL_KEYMAPCHANGED:
+			bad = false;
+			break;
+		case SDL_KEYDOWN:
+		case SDL_KEYUP:
+			bad = recorded.code < 0 || recorded.code >= SDL_NUM_SCANCODES;
+			break;
+		case SDL_MOUSEBUTTONDOWN:
+		case SDL_MOUSEBUTTONUP:
+			bad = recorded.code < SDL_BUTTON_LEFT || recorded.code > SDL_BUTTON_X2;
+			break;
+		case SDL_CONTROLLERBUTTONDOWN:
+		case SDL_CONTROLLERBUTTONUP:
+			bad = recorded.code < 0 || recorded.code >= SDL_CONTROLLER_BUTTON_MAX;
+			break;
+		case SDL_CONTROLLERAXISMOTION:
+			bad = recorded.code < 0 || recorded.code >= SDL_CONTROLLER_AXIS_MAX;
+			break;
+		default:
+			bad = true;
+			break;
+		}
+
+		if (bad)
+		{
+			std::stringstream s;
+			s << "Event record " << path.string() << " has a bad event at index " << i;
+			SetError(BAD_RECORD, s.str());
+			return;
+		}
+	}
+
+	record.resize(header.event_count);
+	std::memcpy(record.data(), data + sizeof(header), header.event_count * sizeof(RecordedEvent));
+}
@@ -0,0 +1,222 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "sib.hpp"
+
+template<typename ActionT>
+Sib::BasicTransitionRing<ActionT>::BasicTransitionRing(Uint32 size)
+{
+	// Round up to a power of two so indices can wrap with a mask
+	Uint32 capacity = 1;
+	while (capacity < size) capacity *= 2;
+
+	buffer.resize(capacity);
+	mask = capacity - 1;
+}
+
+template<typename ActionT>
+bool Sib::BasicTransitionRing<ActionT>::Push(const BasicTransition<ActionT>& transition)
+{
+	Uint32 t = tail.load(std::memory_order_relaxed);
+
+	if (t - head_cache > mask)
+	{
+		head_cache = head.load(std::memory_order_acquire);
+
+		if (t - head_cache > mask)
+		{
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+	}
+
+	buffer[t & mask] = transition;
+	tail.store(t + 1, std::memory_order_release);
+	return true;
+}
+
+template<typename ActionT>
+bool Sib::BasicTransitionRing<ActionT>::Pop(BasicTransition<ActionT>& transition)
+{
+	Uint32 h = head.load(std::memory_order_relaxed);
+
+	if (h == tail_cache)
+	{
+		tail_cache = tail.load(std::memory_order_acquire);
+		if (h == tail_cache) return false;
+	}
+
+	transition = buffer[h & mask];
+	head.store(h + 1, std::memory_order_release);
+	return true;
+}
+
+template<typename ActionT>
+Uint32 Sib::BasicTransitionRing<ActionT>::Capacity()
+{
+	return mask + 1;
+}
+
+template<typename ActionT>
+Uint32 Sib::BasicTransitionRing<ActionT>::Free()
+{
+	// Producer side only, the consumer can only make more room in the meantime
+	head_cache = head.load(std::memory_order_acquire);
+	return mask + 1 - (tail.load(std::memory_order_relaxed) - head_cache);
+}
+
+template<typename ActionT>
+Uint32 Sib::BasicTransitionRing<ActionT>::Dropped()
+{
+	return dropped.load(std::memory_order_relaxed);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicActionState<MaxActions, ActionT>::Apply(const BasicTransition<ActionT>& transition)
+{
+	if (transition.player == PLAYER_RESYNC)
+	{
+		// The held state that follows replaces this one
+		resyncing = transition.pressed;
+
+		if (resyncing)
+		{
+			held.reset();
+
+			for (unsigned int i = 0; i < SIB_MAX_CONTROLLERS; ++i)
+			{
+				player_held[i].reset();
+			}
+		}
+
+		return;
+	}
+
+	if (transition.action >= MaxActions) return;
+
+	ActionMask* p_pressed = &pressed;
+	ActionMask* p_released = &released;
+	ActionMask* p_held = &held;
+
+	if (transition.player >= 0)
+	{
+		if (transition.player >= SIB_MAX_CONTROLLERS) return;
+		p_pressed = &player_pressed[transition.player];
+		p_released = &player_released[transition.player];
+		p_held = &player_held[transition.player];
+	}
+
+	if (transition.pressed)
+	{
+		if (!resyncing) p_pressed->set(transition.action);
+		p_held->set(transition.action);
+	}
+	else
+	{
+		p_released->set(transition.action);
+		p_held->reset(transition.action);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+unsigned int Sib::BasicActionState<MaxActions, ActionT>::Consume(BasicTransitionRing<ActionT>& ring)
+{
+	BasicTransition<ActionT> transition;
+	unsigned int count = 0;
+
+	while (ring.Pop(transition))
+	{
+		Apply(transition);
+		++count;
+	}
+
+	return count;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicActionState<MaxActions, ActionT>::ResetInputs()
+{
+	pressed.reset();
+	released.reset();
+
+	for (unsigned int i = 0; i < SIB_MAX_CONTROLLERS; ++i)
+	{
+		player_pressed[i].reset();
+		player_released[i].reset();
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicActionState<MaxActions, ActionT>::Pressed(ActionT action)
+{
+	return action < MaxActions && pressed[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicActionState<MaxActions, ActionT>::Released(ActionT action)
+{
+	return action < MaxActions && released[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicActionState<MaxActions, ActionT>::Held(ActionT action)
+{
+	return action < MaxActions && held[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicActionState<MaxActions, ActionT>::Pressed(ActionT action, int player)
+{
+	if (action >= MaxActions || player < 0 || player >= SIB_MAX_CONTROLLERS) return false;
+	return player_pressed[player][action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicActionState<MaxActions, ActionT>::Released(ActionT action, int player)
+{
+	if (action >= MaxActions || player < 0 || player >= SIB_MAX_CONTROLLERS) return false;
+	return player_released[player][action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicActionState<MaxActions, ActionT>::Held(ActionT action, int player)
+{
+	if (action >= MaxActions || player < 0 || player >= SIB_MAX_CONTROLLERS) return false;
+	return player_held[player][action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+const typename Sib::BasicActionState<MaxActions, ActionT>::ActionMask& Sib::BasicActionState<MaxActions, ActionT>::PressedMask()
+{
+	return pressed;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+const typename Sib::BasicActionState<MaxActions, ActionT>::ActionMask& Sib::BasicActionState<MaxActions, ActionT>::ReleasedMask()
+{
+	return released;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+const typename Sib::BasicActionState<MaxActions, ActionT>::ActionMask& Sib::BasicActionState<MaxActions, ActionT>::HeldMask()
+{
+	return held;
+}
@@ -0,0 +1,244 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "sib.hpp"
+#include <algorithm>
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicActionSnapshot<MaxActions, ActionT>::WriteBits(std::vector<Uint8>& out, std::size_t& bit, Uint32 value, unsigned int count)
+{
+	for (unsigned int i = 0; i < count; ++i, ++bit)
+	{
+		if ((bit & 7) == 0) out.push_back(0);
+		if ((value >> i) & 1) out.back() |= (Uint8)(1 << (bit & 7));
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicActionSnapshot<MaxActions, ActionT>::ReadBits(const Uint8* data, std::size_t size, std::size_t& bit, Uint32& value, unsigned int count)
+{
+	if (bit + count > size * 8) return false;
+	value = 0;
+
+	for (unsigned int i = 0; i < count; ++i, ++bit)
+	{
+		value |= (Uint32)((data[bit >> 3] >> (bit & 7)) & 1) << i;
+	}
+
+	return true;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicActionSnapshot<MaxActions, ActionT>::WriteMask(std::vector<Uint8>& out, std::size_t& bit, const ActionMask& mask)
+{
+	// Empty masks cost one bit, sparse ones a count and a list of actions, dense ones every bit
+	std::size_t count = mask.count();
+	WriteBits(out, bit, count != 0, 1);
+	if (count == 0) return;
+
+	bool list = COUNT_BITS + count * INDEX_BITS < MaxActions;
+	WriteBits(out, bit, list, 1);
+
+	if (list)
+	{
+		WriteBits(out, bit, (Uint32)count, COUNT_BITS);
+
+		for (std::size_t i = 0; i < MaxActions; ++i)
+		{
+			if (mask[i]) WriteBits(out, bit, (Uint32)i, INDEX_BITS);
+		}
+	}
+	else
+	{
+		for (std::size_t i = 0; i < MaxActions; ++i)
+		{
+			WriteBits(out, bit, mask[i], 1);
+		}
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicActionSnapshot<MaxActions, ActionT>::ReadMask(const Uint8* data, std::size_t size, std::size_t& bit, ActionMask& mask)
+{
+	mask.reset();
+	Uint32 value;
+
+	if (!ReadBits(data, size, bit, value, 1)) return false;
+	if (!value) return true;
+	if (!ReadBits(data, size, bit, value, 1)) return false;
+
+	if (value)
+	{
+		Uint32 count;
+		if (!ReadBits(data, size, bit, count, COUNT_BITS) || count > MaxActions) return false;
+
+		for (Uint32 i = 0; i < count; ++i)
+		{
+			if (!ReadBits(data, size, bit, value, INDEX_BITS) || value >= MaxActions) return false;
+			mask.set(value);
+		}
+	}
+	else
+	{
+		for (std::size_t i = 0; i < MaxActions; ++i)
+		{
+			if (!ReadBits(data, size, bit, value, 1)) return false;
+			mask[i] = value;
+		}
+	}
+
+	return true;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicActionSnapshot<MaxActions, ActionT>::Capture(BasicBinder<MaxActions, ActionT>& binder)
+{
+	pressed = binder.PressedMask();
+	released = binder.ReleasedMask();
+	held = binder.HeldMask();
+	analog.reset();
+
+	// One pass over the bound axes of each controller gives every action's value, the same ones
+	// Value() finds one action at a time
+	Uint16 axis_holds[MaxActions] = {};
+	std::fill(values, values + MaxActions, (Uint16)0);
+
+	const typename BasicBinder<MaxActions, ActionT>::Bindings& table = *binder.active_bindings;
+	const ActionT* actions = table.actions.data();
+
+	for (const typename BasicBinder<MaxActions, ActionT>::ControllerState& controller : binder.controllers)
+	{
+		if (controller.id == -1) continue;
+
+		for (unsigned int axis = 0; axis < AXIS_COUNT; ++axis)
+		{
+			unsigned int input = INPUT_CAXIS + axis;
+			Uint32 end = table.offsets[input + 1];
+			if (table.offsets[input] == end) continue;
+
+			Uint16 value = (Uint16)(binder.AxisValue(axis, controller) * 65535.0f + 0.5f);
+			bool axis_held = controller.inputs_held.test(input);
+
+			for (Uint32 i = table.offsets[input]; i < end; ++i)
+			{
+				if (value > values[actions[i]]) values[actions[i]] = value;
+				if (axis_held) ++axis_holds[actions[i]];
+			}
+		}
+	}
+
+	for (std::size_t i = 0; i < MaxActions; ++i)
+	{
+		// Held by something other than an axis, like a key or button
+		if (binder.held_count[i] > axis_holds[i]) values[i] = 65535;
+
+		// Only values that don't follow from the held bit are sent
+		if (values[i] != (held[i] ? 65535 : 0)) analog.set(i);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicActionSnapshot<MaxActions, ActionT>::Encode(const BasicActionSnapshot& previous, std::vector<Uint8>& out)
+{
+	out.clear();
+	std::size_t bit = 0;
+
+	// Pressed and released start over every tick, held and analog rarely change so only the
+	// actions that differ from the previous tick are written
+	WriteMask(out, bit, pressed);
+	WriteMask(out, bit, released);
+	WriteMask(out, bit, held ^ previous.held);
+	WriteMask(out, bit, analog ^ previous.analog);
+
+	for (std::size_t i = 0; i < MaxActions; ++i)
+	{
+		if (!analog[i]) continue;
+
+		bool changed = !previous.analog[i] || values[i] != previous.values[i];
+		WriteBits(out, bit, changed, 1);
+		if (changed) WriteBits(out, bit, values[i], 16);
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicActionSnapshot<MaxActions, ActionT>::Decode(const BasicActionSnapshot& previous, const Uint8* data, std::size_t size)
+{
+	std::size_t bit = 0;
+	ActionMask held_changes;
+	ActionMask analog_changes;
+
+	if (!ReadMask(data, size, bit, pressed) || !ReadMask(data, size, bit, released) ||
+		!ReadMask(data, size, bit, held_changes) || !ReadMask(data, size, bit, analog_changes))
+	{
+		return false;
+	}
+
+	held = previous.held ^ held_changes;
+	analog = previous.analog ^ analog_changes;
+
+	for (std::size_t i = 0; i < MaxActions; ++i)
+	{
+		if (!analog[i])
+		{
+			values[i] = held[i] ? 65535 : 0;
+			continue;
+		}
+
+		Uint32 value;
+		if (!ReadBits(data, size, bit, value, 1)) return false;
+
+		if (!value)
+		{
+			values[i] = previous.values[i];
+			continue;
+		}
+
+		if (!ReadBits(data, size, bit, value, 16)) return false;
+		values[i] = (Uint16)value;
+	}
+
+	return true;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicActionSnapshot<MaxActions, ActionT>::Pressed(ActionT action)
+{
+	return (std::size_t)action < MaxActions && pressed[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicActionSnapshot<MaxActions, ActionT>::Released(ActionT action)
+{
+	return (std::size_t)action < MaxActions && released[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicActionSnapshot<MaxActions, ActionT>::Held(ActionT action)
+{
+	return (std::size_t)action < MaxActions && held[action];
+}
+
+template<std::size_t MaxActions, typename ActionT>
+float Sib::BasicActionSnapshot<MaxActions, ActionT>::Value(ActionT action)
+{
+	if ((std::size_t)action >= MaxActions) return 0.0f;
+	return values[action] / 65535.0f;
+}
@@ -0,0 +1,181 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "sib.hpp"
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace Sib
+{
+	// Reloads a bind file on its own thread whenever the file changes and hands the new tables to the
+	// Binder, which swaps them in at the next ResetInputs()
+	template<std::size_t MaxActions, typename ActionT>
+	class BasicWatcher
+	{
+		typedef BasicBinder<MaxActions, ActionT> Binder_t;
+
+		Binder_t& binder;
+		std::filesystem::path path;
+		BasicActionNames<ActionT> action_strings;
+		std::atomic<bool> stop = false;
+		std::thread thread;
+
+		void Reload();
+		bool WatchInotify();
+		void WatchPolling();
+		void Run();
+
+	public:
+		BasicWatcher(Binder_t& binder, std::filesystem::path path);
+		~BasicWatcher();
+		BasicWatcher(const BasicWatcher&) = delete;
+		BasicWatcher& operator=(const BasicWatcher&) = delete;
+	};
+
+	typedef BasicWatcher<SIB_MAX_ACTIONS, Action_t> Watcher;
+}
+
+template<std::size_t MaxActions, typename ActionT>
+Sib::BasicWatcher<MaxActions, ActionT>::BasicWatcher(Binder_t& binder_in, std::filesystem::path path_in)
+	: binder(binder_in), path(path_in), action_strings(binder_in.action_strings)
+{
+	thread = std::thread(&BasicWatcher::Run, this);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+Sib::BasicWatcher<MaxActions, ActionT>::~BasicWatcher()
+{
+	stop = true;
+	thread.join();
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicWatcher<MaxActions, ActionT>::Reload()
+{
+	// A separate Binder does the parsing, so the live one is never touched from this thread
+	typename Binder_t::StagedBindings* staged = new typename Binder_t::StagedBindings;
+	Binder_t parser;
+	parser.action_strings = action_strings;
+	parser.staging = staged;
+	parser.ReadFile(path);
+
+	// The file can briefly be missing while an editor replaces it, a later event will reload it
+	if (parser.error == OPEN_FILE)
+	{
+		delete staged;
+		return;
+	}
+
+	// A file with errors leaves the current tables in place, only the error is handed over
+	if (parser.error != NO_ERROR)
+	{
+		staged->error = parser.error;
+		staged->error_str = parser.ErrorStr();
+		staged->combos.clear();
+	}
+	else
+	{
+		staged->bindings = std::move(parser.bindings);
+	}
+
+	// Replace tables the Binder hasn't picked up yet
+	delete binder.staged_bindings.exchange(staged, std::memory_order_acq_rel);
+}
+
+template<std::size_t MaxActions, typename ActionT>
+bool Sib::BasicWatcher<MaxActions, ActionT>::WatchInotify()
+{
+#ifdef __linux__
+	int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (fd < 0) return false;
+
+	// Watch the directory, editors often save by writing a new file and renaming it over the old one
+	std::filesystem::path dir = path.parent_path();
+	if (dir.empty()) dir = ".";
+
+	if (inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	std::string filename = path.filename().string();
+	alignas(inotify_event) char buffer[4096];
+
+	while (!stop)
+	{
+		pollfd p = {fd, POLLIN, 0};
+		if (poll(&p, 1, 100) <= 0) continue;
+
+		bool changed = false;
+		ssize_t size;
+
+		while ((size = read(fd, buffer, sizeof(buffer))) > 0)
+		{
+			for (char* ptr = buffer; ptr < buffer + size; )
+			{
+				const inotify_event* event = (const inotify_event*)ptr;
+				if (event->len && filename == event->name) changed = true;
+				ptr += sizeof(inotify_event) + event->len;
+			}
+		}
+
+		if (changed) Reload();
+	}
+
+	close(fd);
+	return true;
+#else
+	return false;
+#endif
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicWatcher<MaxActions, ActionT>::WatchPolling()
+{
+	std::error_code ec;
+	std::filesystem::file_time_type last = std::filesystem::last_write_time(path, ec);
+
+	while (!stop)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(250));
+
+		std::filesystem::file_time_type time = std::filesystem::last_write_time(path, ec);
+		if (ec || time == last) continue;
+
+		last = time;
+		Reload();
+	}
+}
+
+template<std::size_t MaxActions, typename ActionT>
+void Sib::BasicWatcher<MaxActions, ActionT>::Run()
+{
+	if (!WatchInotify()) WatchPolling();
+}
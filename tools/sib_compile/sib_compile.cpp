@@ -0,0 +1,122 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Converts a text bind file into a compiled profile that LoadCompiled() can read.
+//
+// usage: sib_compile actions.txt binds.txt [binds.sibc]
+//
+// actions.txt has one "action_string action_number" pair per line. The output defaults to the
+// input path with a .sibc extension.
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <SDL.h>
+#include "sib.hpp"
+
+static bool error = false;
+
+void ErrorCallback(Sib::Error_t, const char* error_str)
+{
+	std::fprintf(stderr, "%s\n", error_str);
+	error = true;
+}
+
+static bool ReadActions(Sib::Binder& binder, const std::filesystem::path& path)
+{
+	std::ifstream file(path);
+
+	if (file.fail())
+	{
+		std::fprintf(stderr, "Failed to open file: %s\n", path.string().c_str());
+		return false;
+	}
+
+	std::string line;
+	unsigned int n = 0;
+
+	while (std::getline(file, line))
+	{
+		std::stringstream s(line);
+		std::string action_str;
+		unsigned int action;
+
+		if (!(s >> action_str))
+		{
+			++n;
+			continue;
+		}
+
+		if (!(s >> action))
+		{
+			std::fprintf(stderr, "%s line %u: expected \"action_string action_number\"\n", path.string().c_str(), n);
+			return false;
+		}
+
+		if (action >= SIB_MAX_ACTIONS)
+		{
+			std::fprintf(stderr, "%s line %u: action %u not in range 0-%d\n", path.string().c_str(), n, action, SIB_MAX_ACTIONS - 1);
+			return false;
+		}
+
+		binder.ActionSetString((Sib::Action_t)action, action_str);
+		++n;
+	}
+
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 3 || argc > 4)
+	{
+		std::fprintf(stderr, "usage: sib_compile actions.txt binds.txt [binds.sibc]\n");
+		return 1;
+	}
+
+	std::filesystem::path binds_path = argv[2];
+	std::filesystem::path out_path = binds_path;
+	out_path.replace_extension(".sibc");
+	if (argc == 4) out_path = argv[3];
+
+	// Keycodes need a keymap, the dummy video driver provides the default one without a display
+	SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+
+	if (SDL_Init(SDL_INIT_VIDEO) != 0)
+	{
+		std::fprintf(stderr, "SDL_Init failed, keycodes won't resolve: %s\n", SDL_GetError());
+	}
+
+	Sib::Binder binder;
+	binder.ErrorCallback(ErrorCallback);
+
+	if (!ReadActions(binder, argv[1]))
+	{
+		SDL_Quit();
+		return 1;
+	}
+
+	binder.ReadFile(binds_path);
+	if (!error) binder.SaveCompiled(out_path);
+
+	SDL_Quit();
+	return error ? 1 : 0;
+}
@@ -0,0 +1,127 @@
+// Copyright (c) 2024 Bryan Rykowski
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Replays an event record through a compiled profile without SDL, a window or a display.
+//
+// usage: sib_replay [-t] binds.sibc session.sibr [passes]
+//
+// The first pass hashes every transition so runs can be compared, -t also prints them. The
+// following passes are timed.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <SDL.h>
+#include "sib.hpp"
+
+typedef std::chrono::steady_clock Clock;
+
+static bool error = false;
+
+void ErrorCallback(Sib::Error_t, const char* error_str)
+{
+	std::fprintf(stderr, "%s\n", error_str);
+	error = true;
+}
+
+static Uint64 HashTransitions(Sib::Binder& binder, Uint64 hash, bool print)
+{
+	const Sib::Transition* transitions = binder.Transitions();
+
+	for (unsigned int i = 0; i < binder.TransitionCount(); ++i)
+	{
+		const Sib::Transition& t = transitions[i];
+		const Uint32 fields[4] = {t.timestamp, t.action, t.pressed, (Uint32)t.player};
+
+		for (Uint32 field : fields)
+		{
+			hash = (hash ^ field) * 0x100000001b3;
+		}
+
+		if (print) std::printf("%10u %2d %3u %s\n", t.timestamp, t.player, t.action, t.pressed ? "pressed" : "released");
+	}
+
+	return hash;
+}
+
+int main(int argc, char** argv)
+{
+	bool print = argc > 1 && std::strcmp(argv[1], "-t") == 0;
+	int arg = print ? 2 : 1;
+
+	if (argc - arg < 2 || argc - arg > 3)
+	{
+		std::fprintf(stderr, "usage: sib_replay [-t] binds.sibc session.sibr [passes]\n");
+		return 1;
+	}
+
+	int passes = argc - arg == 3 ? std::atoi(argv[arg + 2]) : 10;
+
+	Sib::Binder binder;
+	binder.ErrorCallback(ErrorCallback);
+	binder.LoadCompiled(argv[arg]);
+
+	std::vector<Sib::RecordedEvent> record;
+	binder.LoadRecord(argv[arg + 1], record);
+	if (error) return 1;
+
+	// Transitions only last until ResetInputs(), so hash them at each end of frame marker
+	Uint64 hash = 0xcbf29ce484222325;
+	std::size_t frames = 0;
+
+	for (const Sib::RecordedEvent& event : record)
+	{
+		if (event.type == 0)
+		{
+			hash = HashTransitions(binder, hash, print);
+			++frames;
+		}
+
+		binder.ReplayEvent(event);
+	}
+
+	hash = HashTransitions(binder, hash, print);
+	binder.ResetInputs();
+
+	Clock::time_point start = Clock::now();
+
+	for (int i = 0; i < passes; ++i)
+	{
+		binder.ReplayEvents(record.data(), record.size());
+	}
+
+	Clock::time_point end = Clock::now();
+	double seconds = std::chrono::duration<double>(end - start).count();
+	double events = (double)(record.size() - frames) * passes;
+
+	std::printf("events:     %zu (%zu frames)\n", record.size() - frames, frames);
+	std::printf("hash:       %016llx\n", (unsigned long long)hash);
+
+	// Frame markers are replayed too, their ResetInputs() calls are counted in the event time
+	if (passes > 0 && events > 0)
+	{
+		std::printf("ns/event:   %.2f\n", seconds * 1e9 / events);
+		std::printf("events/sec: %.0f\n", events / seconds);
+	}
+
+	return error ? 1 : 0;
+}